@@ -37,6 +37,8 @@ extern "C" {
 #define USER_AUTOTEST_START_SUITE   "[STARTSUITE]"
 /** @def USER_AUTOTEST_START_SUITE prefix for test suite end messages */
 #define USER_AUTOTEST_END_SUITE     "[ENDSUITE  ]"
+/** @def USER_AUTOTEST_PERF prefix for machine-readable performance reports */
+#define USER_AUTOTEST_PERF    "[PERF      ]"
 
 /**
  * @def backing autotest formatting mechanims, adding function name and line
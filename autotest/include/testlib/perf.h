@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LIBTEST_PERF_H
+#define LIBTEST_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file perf.h
+ *
+ * testlib performance measurement API. Samples are stored by the caller
+ * (on its stack, as autotest do not support globals), and reduced to
+ * min/median/p99/max when reported.
+ *
+ * The report line is machine-readable, so that it can be compared against
+ * a stored baseline by the test harness:
+ *
+ * [AT][PERF      ] func:line: name=<name> unit=<unit> samples=<n> min=<v> median=<v> p99=<v> max=<v>
+ */
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <testlib/log.h>
+#include <uapi/uapi.h>
+
+/**
+ * @brief get back current timestamp, in cycles
+ *
+ * Only the lower 32 bits are kept, as measured sequences are far shorter
+ * than a 32 bits cycle counter wrap. Requires CAP_TIM_HP_CHRONO.
+ */
+static inline uint32_t perf_get_cycle(void)
+{
+    uint64_t cycle = 0;
+    __sys_get_cycle(PRECISION_CYCLE);
+    copy_from_kernel((uint8_t*)&cycle, sizeof(uint64_t));
+    return (uint32_t)cycle;
+}
+
+/**
+ * @brief get back current timestamp, in microseconds
+ */
+static inline uint64_t perf_get_micro(void)
+{
+    uint64_t micro = 0;
+    __sys_get_cycle(PRECISION_MICROSECONDS);
+    copy_from_kernel((uint8_t*)&micro, sizeof(uint64_t));
+    return micro;
+}
+
+/**
+ * @brief remove the measurement overhead from all samples, saturating to 0
+ */
+static inline void perf_sub_overhead(uint32_t *samples, size_t num, uint32_t overhead)
+{
+    for (size_t i = 0; i < num; ++i) {
+        samples[i] = (samples[i] > overhead) ? samples[i] - overhead : 0;
+    }
+}
+
+/**
+ * @brief in place insertion sort, sample sets are small enough
+ */
+static inline void perf_sort(uint32_t *samples, size_t num)
+{
+    for (size_t i = 1; i < num; ++i) {
+        uint32_t val = samples[i];
+        size_t j = i;
+        while ((j > 0) && (samples[j - 1] > val)) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = val;
+    }
+}
+
+/**
+ * @brief nearest-rank percentile of a sorted, non-empty, sample set
+ */
+static inline uint32_t perf_percentile(const uint32_t *sorted, size_t num, uint32_t pct)
+{
+    size_t rank = ((num * pct) + 99UL) / 100UL;
+    if (rank == 0) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+/** @fn perf_report sort the given samples and print the machine-readable report line */
+static inline void perf_report(const char *func, int line, const char *name,
+                               const char *unit, uint32_t *samples, size_t num)
+{
+    if (num == 0) {
+        pr_autotest(USER_AUTOTEST_FAIL, func, line, "%s: no sample", name);
+        return;
+    }
+    perf_sort(samples, num);
+    pr_autotest(USER_AUTOTEST_PERF, func, line,
+                "name=%s unit=%s samples=%lu min=%lu median=%lu p99=%lu max=%lu",
+                name, unit, (uint32_t)num, samples[0], perf_percentile(samples, num, 50),
+                perf_percentile(samples, num, 99), samples[num - 1]);
+}
+
+/** @def PERF_REPORT() report the given sample set, using current function name and line */
+#define PERF_REPORT(name, unit, samples, num) \
+    perf_report(__func__, __LINE__, name, unit, samples, num)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif/*!LIBTEST_PERF_H*/
@@ -21,6 +21,10 @@
 #include "tests/test_shm.h"
 #include "tests/test_dma.h"
 #include "tests/test_irq.h"
+#include "tests/test_masking.h"
+#include "tests/test_kstat.h"
+#include "tests/test_perf.h"
+#include "tests/test_irqprobe.h"
 
 uint32_t __stack_chk_guard = 0;
 
@@ -67,6 +71,12 @@ void __attribute__((no_stack_protector, used, noreturn)) autotest(uint32_t label
 #ifdef CONFIG_TEST_SLEEP
     test_sleep();
 #endif
+#ifdef CONFIG_TEST_MASKING
+    test_masking();
+#endif
+#ifdef CONFIG_TEST_KSTAT
+    test_kstat();
+#endif
 #ifdef CONFIG_TEST_GPIO
     test_gpio();
 #endif
@@ -81,6 +91,13 @@ void __attribute__((no_stack_protector, used, noreturn)) autotest(uint32_t label
 #endif
 #ifdef CONFIG_TEST_IRQ
     test_irq();
+#endif
+#ifdef CONFIG_TEST_IRQ_PROBE
+    test_irqprobe();
+#endif
+#ifdef CONFIG_TEST_PERF
+    /* executed last, so that all other suites are not impacted */
+    test_perf();
 #endif
     LOG("AUTOTEST END");
 
@@ -79,18 +79,61 @@ void test_cycles_precision(void)
     ASSERT_EQ(nano_st, STATUS_OK);
     ASSERT_GT((uint32_t)((nano*1000ULL) - micro), 0);
 
+#ifdef CONFIG_TEST_PERF
+    /* perf suite requires the high precision chronometer capability */
+    ASSERT_EQ(cycle_st, STATUS_OK);
+#else
     ASSERT_EQ(cycle_st, STATUS_DENIED);
+#endif
 
     TEST_END();
 
     return;
 }
 
+void test_cycles_kinfo(void)
+{
+    const kinfo_page_t *kinfo;
+    uint64_t milli, kmilli, start, stop;
+    uint32_t idx;
+    TEST_START();
+    kinfo = kinfo_get_page();
+    if (kinfo == NULL) {
+        /* kernel built without information page */
+        ASSERT_EQ(__sys_get_kinfo_page(), STATUS_NO_ENTITY);
+        goto end;
+    }
+    ASSERT_EQ(kinfo->magic, KINFO_MAGIC);
+    ASSERT_GT(kinfo->cycles_per_usec, 0);
+
+    __sys_sched_yield();
+    __sys_get_cycle(PRECISION_MILLISECONDS);
+    copy_from_kernel((uint8_t*)&milli, sizeof(uint64_t));
+    kmilli = kinfo_get_milliseconds(kinfo);
+    /* page time is updated at each tick, the syscall one is finer */
+    ASSERT_GE((uint32_t)kmilli, (uint32_t)milli - (1000UL / kinfo->systick_hz));
+    ASSERT_GE((uint32_t)milli, (uint32_t)kmilli);
+
+    __sys_get_cycle(PRECISION_MICROSECONDS);
+    copy_from_kernel((uint8_t*)&start, sizeof(uint64_t));
+    for (idx = 0; idx <= 1000; ++idx) {
+        kmilli = kinfo_get_milliseconds(kinfo);
+    }
+    __sys_get_cycle(PRECISION_MICROSECONDS);
+    copy_from_kernel((uint8_t*)&stop, sizeof(uint64_t));
+    LOG("average kinfo time read cost: %lu", (uint32_t)((stop - start) / idx));
+
+    /* autotest and idle tasks are published */
+    ASSERT_GE(kinfo->num_tasks, 2);
+end:
+    TEST_END();
+}
 
 void test_cycles(void)
 {
     TEST_SUITE_START("sys_cycles");
     test_cycles_duration();
     test_cycles_precision();
+    test_cycles_kinfo();
     TEST_SUITE_END("sys_cycles");
 }
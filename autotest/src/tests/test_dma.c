@@ -160,6 +160,116 @@ static void test_dma_start_n_wait_stream(dmah_t stream)
     TEST_END();
 }
 
+/*
+ * the linked-list table of the stream is allocated by the kernel in the
+ * SHM_NOMAP_DMAPOOL DMA pool (shms[3]) at assign time, and released at unassign
+ */
+static void test_dma_linked_list_stream(void)
+{
+    Status res;
+    dmah_t stream;
+    shmh_t lli_pool;
+    gpdma_stream_cfg_t stream_info;
+    uint32_t offset;
+    TEST_START();
+    res = __sys_get_dma_stream_handle(0x3);
+    copy_from_kernel((uint8_t*)&stream, sizeof(dmah_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_dma_get_stream_info(stream);
+    copy_from_kernel((uint8_t*)&stream_info, sizeof(gpdma_stream_cfg_t));
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ((uint32_t)stream_info.linked_list, GPDMA_LINKED_LIST_DOUBLE_BUFFER);
+    ASSERT_EQ((uint32_t)stream_info.interrupts, GPDMA_INT_TC | GPDMA_INT_HT | GPDMA_INT_ERROR);
+    res = __sys_get_shm_handle(shms[3].id);
+    copy_from_kernel((uint8_t*)&lli_pool, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_dma_assign_stream(stream);
+    ASSERT_EQ(res, STATUS_OK);
+    /* first pool block is used by the stream linked-list table */
+    res = __sys_shm_dma_alloc(lli_pool, 4);
+    copy_from_kernel((uint8_t*)&offset, sizeof(uint32_t));
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_NE(offset, 0);
+    res = __sys_shm_dma_free(lli_pool, offset);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_dma_unassign_stream(stream);
+    ASSERT_EQ(res, STATUS_OK);
+    /* table released */
+    res = __sys_shm_dma_alloc(lli_pool, 4);
+    copy_from_kernel((uint8_t*)&offset, sizeof(uint32_t));
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(offset, 0);
+    res = __sys_shm_dma_free(lli_pool, offset);
+    ASSERT_EQ(res, STATUS_OK);
+    TEST_END();
+}
+
+static dmah_t test_dma_get_stream(uint32_t label)
+{
+    Status res;
+    dmah_t stream = 0;
+    res = __sys_get_dma_stream_handle(label);
+    copy_from_kernel((uint8_t*)&stream, sizeof(dmah_t));
+    ASSERT_EQ(res, STATUS_OK);
+    return stream;
+}
+
+static uint32_t test_dma_get_channel(dmah_t stream)
+{
+    Status res;
+    gpdma_stream_cfg_t stream_info;
+    res = __sys_dma_get_stream_info(stream);
+    copy_from_kernel((uint8_t*)&stream_info, sizeof(gpdma_stream_cfg_t));
+    ASSERT_EQ(res, STATUS_OK);
+    return stream_info.channel;
+}
+
+/*
+ * stream2 and stream4 are pooled streams, sharing gpdma1 channels 1 and 2,
+ * while stream3 is statically bound to channel 1
+ */
+static void test_dma_channel_pool(void)
+{
+    Status res;
+    dmah_t static_stream;
+    dmah_t pooled_stream1;
+    dmah_t pooled_stream2;
+    TEST_START();
+    static_stream = test_dma_get_stream(0x3);
+    pooled_stream1 = test_dma_get_stream(0x2);
+    pooled_stream2 = test_dma_get_stream(0x4);
+    res = __sys_dma_assign_stream(static_stream);
+    ASSERT_EQ(res, STATUS_OK);
+    /* DTS channel is held, the pooled stream gets the other pool channel */
+    res = __sys_dma_assign_stream(pooled_stream1);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(test_dma_get_channel(pooled_stream1), 2);
+    /* pool exhausted */
+    res = __sys_dma_assign_stream(pooled_stream2);
+    ASSERT_EQ(res, STATUS_BUSY);
+    res = __sys_dma_unassign_stream(pooled_stream1);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(test_dma_get_channel(pooled_stream1), 1);
+    /* channel released and allocated again */
+    res = __sys_dma_assign_stream(pooled_stream2);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(test_dma_get_channel(pooled_stream2), 2);
+    res = __sys_dma_unassign_stream(static_stream);
+    ASSERT_EQ(res, STATUS_OK);
+    /* DTS channel is tried first */
+    res = __sys_dma_assign_stream(pooled_stream1);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(test_dma_get_channel(pooled_stream1), 1);
+    /* static streams do not fall back to the pool */
+    res = __sys_dma_assign_stream(static_stream);
+    ASSERT_EQ(res, STATUS_BUSY);
+    res = __sys_dma_unassign_stream(pooled_stream1);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_dma_unassign_stream(pooled_stream2);
+    ASSERT_EQ(res, STATUS_OK);
+    TEST_END();
+}
+
 static void test_dma_get_info(dmah_t stream)
 {
     Status res;
@@ -210,6 +320,8 @@ void test_dma(void)
     test_dma_start_stream(m2mstream);
     test_dma_get_stream_status(m2mstream);
     test_dma_stop_stream(m2mstream);
+    test_dma_linked_list_stream();
+    test_dma_channel_pool();
 #endif
     TEST_SUITE_END("sys_dma");
 }
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inttypes.h>
+#include <testlib/log.h>
+#include <testlib/assert.h>
+#include <testlib/perf.h>
+#include <uapi/uapi.h>
+#include <uapi/types.h>
+#include "test_irqprobe.h"
+
+#define IRQPROBE_SAMPLES 32UL
+/* autotest task quantum, in ticks */
+#define IRQPROBE_QUANTUM 10UL
+
+/*
+ * receive the probe interrupt, and get back the kernel entry and owner
+ * wake-up latencies of this very interrupt
+ */
+static Status test_irqprobe_receive(uint32_t *entry, uint32_t *wakeup)
+{
+    kernel_stat_infos_t infos;
+    Status res;
+
+    res = __sys_wait_for_event(EVENT_TYPE_IRQ, 100L);
+    if (res != STATUS_OK) {
+        goto end;
+    }
+    __sys_get_kernel_stat(KERNEL_STAT_IRQ_PROBE_ENTRY, 0);
+    copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+    *entry = infos.last;
+    __sys_get_kernel_stat(KERNEL_STAT_IRQ_PROBE_WAKEUP, 0);
+    copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+    *wakeup = infos.last;
+end:
+    return res;
+}
+
+void test_irqprobe_trigger(void)
+{
+    uint8_t tab[32];
+    exchange_event_t *event = (exchange_event_t*)tab;
+    Status res, busy;
+
+    TEST_START();
+    res = __sys_trigger_irq_probe(5);
+    busy = __sys_trigger_irq_probe(0);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(busy, STATUS_BUSY);
+    res = __sys_wait_for_event(EVENT_TYPE_IRQ, 100L);
+    copy_from_kernel(tab, sizeof(exchange_event_t) + 4);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ((uint32_t)event->type, (uint32_t)EVENT_TYPE_IRQ);
+    /* kernel owned interrupt, no source device */
+    ASSERT_EQ((uint32_t)event->source, 0UL);
+    /* delivered, can be triggered again */
+    res = __sys_trigger_irq_probe(0);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_wait_for_event(EVENT_TYPE_IRQ, 100L);
+    ASSERT_EQ(res, STATUS_OK);
+    TEST_END();
+}
+
+/*
+ * The probe interrupt is triggered at syscall exit, while its owner is the
+ * running task.
+ */
+void test_irqprobe_owner_running(void)
+{
+    uint32_t entry[IRQPROBE_SAMPLES];
+    uint32_t wakeup[IRQPROBE_SAMPLES];
+    uint32_t failures = 0;
+
+    TEST_START();
+    for (uint32_t i = 0; i < IRQPROBE_SAMPLES; ++i) {
+        __sys_trigger_irq_probe(0);
+        if (test_irqprobe_receive(&entry[i], &wakeup[i]) != STATUS_OK) {
+            failures++;
+        }
+    }
+    ASSERT_EQ(failures, 0UL);
+    PERF_REPORT("irqprobe_running_entry", "cycles", entry, IRQPROBE_SAMPLES);
+    PERF_REPORT("irqprobe_running_wakeup", "cycles", wakeup, IRQPROBE_SAMPLES);
+    TEST_END();
+}
+
+/*
+ * The probe interrupt is triggered at a systick while its owner is waiting
+ * for it. The quantum is refreshed before each trigger so that the various
+ * quantum phases are sampled.
+ */
+void test_irqprobe_owner_waiting(void)
+{
+    uint32_t entry[IRQPROBE_SAMPLES];
+    uint32_t wakeup[IRQPROBE_SAMPLES];
+    uint32_t failures = 0;
+
+    TEST_START();
+    for (uint32_t i = 0; i < IRQPROBE_SAMPLES; ++i) {
+        __sys_sched_yield();
+        __sys_trigger_irq_probe(1UL + (i % IRQPROBE_QUANTUM));
+        if (test_irqprobe_receive(&entry[i], &wakeup[i]) != STATUS_OK) {
+            failures++;
+        }
+    }
+    ASSERT_EQ(failures, 0UL);
+    PERF_REPORT("irqprobe_waiting_entry", "cycles", entry, IRQPROBE_SAMPLES);
+    PERF_REPORT("irqprobe_waiting_wakeup", "cycles", wakeup, IRQPROBE_SAMPLES);
+    TEST_END();
+}
+
+void test_irqprobe(void)
+{
+    TEST_SUITE_START("sys_irq_probe");
+    test_irqprobe_trigger();
+    test_irqprobe_owner_running();
+    test_irqprobe_owner_waiting();
+    TEST_SUITE_END("sys_irq_probe");
+}
@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TEST_IRQPROBE_H
+#define TEST_IRQPROBE_H
+
+void test_irqprobe(void);
+
+#endif/*!TEST_IRQPROBE_H*/
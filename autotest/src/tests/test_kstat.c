@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inttypes.h>
+#include <testlib/log.h>
+#include <testlib/assert.h>
+#include <testlib/perf.h>
+#include <uapi/uapi.h>
+#include "test_kstat.h"
+
+void test_kstat_invalid(void)
+{
+    TEST_START();
+    ASSERT_EQ(__sys_get_kernel_stat(KERNEL_STAT_SYSCALL, 0xffff), STATUS_NO_ENTITY);
+    ASSERT_EQ(__sys_get_kernel_stat(KERNEL_STAT_SYSTICK, 1), STATUS_NO_ENTITY);
+    ASSERT_EQ(__sys_get_kernel_stat(KERNEL_STAT_USER_IRQ, 1), STATUS_NO_ENTITY);
+    TEST_END();
+}
+
+void test_kstat_syscall_count(void)
+{
+    kernel_stat_infos_t before = {0};
+    kernel_stat_infos_t after = {0};
+    Status before_st, after_st;
+    uint32_t idx;
+
+    TEST_START();
+    before_st = __sys_get_kernel_stat(KERNEL_STAT_SYSCALL, SYSCALL_GET_CYCLE);
+    copy_from_kernel((uint8_t*)&before, sizeof(kernel_stat_infos_t));
+    for (idx = 0; idx < 100; ++idx) {
+        __sys_get_cycle(PRECISION_MILLISECONDS);
+    }
+    after_st = __sys_get_kernel_stat(KERNEL_STAT_SYSCALL, SYSCALL_GET_CYCLE);
+    copy_from_kernel((uint8_t*)&after, sizeof(kernel_stat_infos_t));
+
+    ASSERT_EQ(before_st, STATUS_OK);
+    ASSERT_EQ(after_st, STATUS_OK);
+    ASSERT_EQ(after.count - before.count, 100UL);
+    ASSERT_GT(after.min, 0UL);
+    ASSERT_LE(after.min, after.max);
+    TEST_END();
+}
+
+void test_kstat_systick(void)
+{
+    kernel_stat_infos_t infos = {0};
+    Status st;
+    SleepDuration duration;
+
+    duration.tag = SLEEP_DURATION_ARBITRARY_MS;
+    duration.arbitrary_ms = 10;
+    TEST_START();
+    /* be sure that at least some ticks are received */
+    __sys_sleep(duration, SLEEP_MODE_DEEP);
+    st = __sys_get_kernel_stat(KERNEL_STAT_SYSTICK, 0);
+    copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+    ASSERT_EQ(st, STATUS_OK);
+    ASSERT_GE(infos.count, 10UL);
+    ASSERT_GT(infos.max, 0UL);
+    TEST_END();
+}
+
+/*
+ * Not a test per se, but dump all the per-syscall statistics, so that a
+ * regression can be easily spotted when comparing two autotest outputs.
+ */
+void test_kstat_dump(void)
+{
+    kernel_stat_infos_t infos;
+    Status st;
+
+    TEST_START();
+    for (uint32_t id = SYSCALL_EXIT; id <= SYSCALL_GET_KERNEL_STAT; ++id) {
+        st = __sys_get_kernel_stat(KERNEL_STAT_SYSCALL, id);
+        copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+        ASSERT_EQ(st, STATUS_OK);
+        if (infos.count == 0) {
+            continue;
+        }
+        LOG("syscall %lu: count %lu, min %lu, max %lu, avg %lu",
+            id, infos.count, infos.min, infos.max,
+            (uint32_t)(infos.total / infos.count));
+    }
+    st = __sys_get_kernel_stat(KERNEL_STAT_SYSTICK, 0);
+    copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+    ASSERT_EQ(st, STATUS_OK);
+    if (infos.count != 0) {
+        LOG("systick: count %lu, min %lu, max %lu, avg %lu",
+            infos.count, infos.min, infos.max,
+            (uint32_t)(infos.total / infos.count));
+    }
+    st = __sys_get_kernel_stat(KERNEL_STAT_USER_IRQ, 0);
+    copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+    ASSERT_EQ(st, STATUS_OK);
+    if (infos.count != 0) {
+        LOG("user irq: count %lu, min %lu, max %lu, avg %lu",
+            infos.count, infos.min, infos.max,
+            (uint32_t)(infos.total / infos.count));
+    }
+    TEST_END();
+}
+
+/*
+ * Task layout MPU loading duration, as measured by the kernel at each handler
+ * exit. Each sample is the load that happened at the exit of the previous
+ * syscall, so that the distribution is the one of the current task layout.
+ */
+#define KSTAT_MPU_LOAD_SAMPLES 32
+
+void test_kstat_mpu_load(void)
+{
+    kernel_stat_infos_t infos;
+    uint32_t samples[KSTAT_MPU_LOAD_SAMPLES];
+    Status st;
+
+    TEST_START();
+    for (uint32_t i = 0; i < KSTAT_MPU_LOAD_SAMPLES; ++i) {
+        st = __sys_get_kernel_stat(KERNEL_STAT_MPU_LOAD, 0);
+        copy_from_kernel((uint8_t*)&infos, sizeof(kernel_stat_infos_t));
+        ASSERT_EQ(st, STATUS_OK);
+        samples[i] = infos.last;
+    }
+    ASSERT_GT(infos.count, 0UL);
+    PERF_REPORT("mpu_layout_load", "cycles", samples, KSTAT_MPU_LOAD_SAMPLES);
+    TEST_END();
+}
+
+void test_kstat(void)
+{
+    TEST_SUITE_START("sys_get_kernel_stat");
+    test_kstat_invalid();
+    test_kstat_syscall_count();
+    test_kstat_systick();
+    test_kstat_dump();
+    test_kstat_mpu_load();
+    TEST_SUITE_END("sys_get_kernel_stat");
+}
@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TEST_KSTAT_H
+#define TEST_KSTAT_H
+
+void test_kstat(void);
+
+#endif/*!TEST_KSTAT_H*/
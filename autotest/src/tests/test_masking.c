@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inttypes.h>
+#include <testlib/log.h>
+#include <testlib/assert.h>
+#include <uapi/uapi.h>
+#include "test_masking.h"
+
+void test_masking_invalid(void)
+{
+    TEST_START();
+    ASSERT_EQ(__sys_get_kernel_stat(KERNEL_STAT_MASKED_WINDOW, 1), STATUS_NO_ENTITY);
+    ASSERT_EQ(__sys_get_kernel_stat((KernelStat)0xff, 0), STATUS_NO_ENTITY);
+    TEST_END();
+}
+
+void test_masking_window(void)
+{
+    kernel_stat_infos_t before = {0};
+    kernel_stat_infos_t after = {0};
+    Status before_st, after_st;
+    SleepDuration duration;
+    uint32_t idx;
+
+    duration.tag = SLEEP_DURATION_ARBITRARY_MS;
+    duration.arbitrary_ms = 1;
+    TEST_START();
+    /* as svc exchange is zeroified by __sys_log usage, values are
+     * copied back just after the syscall
+     */
+    before_st = __sys_get_kernel_stat(KERNEL_STAT_MASKED_WINDOW, 0);
+    copy_from_kernel((uint8_t*)&before, sizeof(kernel_stat_infos_t));
+    /*
+     * kernel workload: synchronous syscalls, elections, delayed jobs and
+     * periodic ticks. Each kernel entry is a masked window
+     */
+    for (idx = 0; idx < 100; ++idx) {
+        __sys_sched_yield();
+        __sys_get_cycle(PRECISION_MICROSECONDS);
+        if ((idx % 10) == 0) {
+            __sys_sleep(duration, SLEEP_MODE_DEEP);
+        }
+    }
+    after_st = __sys_get_kernel_stat(KERNEL_STAT_MASKED_WINDOW, 0);
+    copy_from_kernel((uint8_t*)&after, sizeof(kernel_stat_infos_t));
+
+    ASSERT_EQ(before_st, STATUS_OK);
+    ASSERT_EQ(after_st, STATUS_OK);
+    /* at least one yield and one get_cycle per loop */
+    ASSERT_GE(after.count - before.count, 200UL);
+    ASSERT_GT(after.max, 0UL);
+    ASSERT_LE(after.min, after.max);
+    LOG("masked window (cycles): count %lu, min %lu, max %lu, avg %lu",
+        after.count, after.min, after.max,
+        (uint32_t)(after.total / after.count));
+#if CONFIG_TEST_MASKING_MAX_CYCLES > 0
+    ASSERT_LE(after.max, (uint32_t)CONFIG_TEST_MASKING_MAX_CYCLES);
+#endif
+    TEST_END();
+}
+
+void test_masking(void)
+{
+    TEST_SUITE_START("kernel_masking");
+    test_masking_invalid();
+    test_masking_window();
+    TEST_SUITE_END("kernel_masking");
+}
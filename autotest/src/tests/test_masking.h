@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TEST_MASKING_H
+#define TEST_MASKING_H
+
+void test_masking(void);
+
+#endif/*!TEST_MASKING_H*/
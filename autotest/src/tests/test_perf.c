@@ -0,0 +1,327 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inttypes.h>
+#include <testlib/log.h>
+#include <testlib/assert.h>
+#include <testlib/perf.h>
+#include <uapi/uapi.h>
+#include <uapi/types.h>
+#ifdef CONFIG_TEST_SHM
+#include <shms-dt.h>
+#endif
+#ifdef CONFIG_AUTOTEST_TIMER_DRIVER
+#include <drivers/timer.h>
+#endif
+#ifdef CONFIG_TEST_DMA
+#include <uapi/dma.h>
+#endif
+#include "test_perf.h"
+
+/*
+ * All measurements are made in a first loop, without any log emitted, and
+ * reported afterward. The svc exchange area is clobbered by logs, and logging
+ * would impact the measurements.
+ * All cycle samples are corrected with the measurement overhead (two
+ * consecutive timestamps), calibrated first.
+ */
+
+#define PERF_SAMPLES CONFIG_TEST_PERF_SAMPLES
+
+static uint32_t test_perf_calibrate(void)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t overhead;
+
+    TEST_START();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        samples[i] = perf_get_cycle() - start;
+    }
+    PERF_REPORT("overhead", "cycles", samples, PERF_SAMPLES);
+    /* sorted by report, use the median as reference */
+    overhead = perf_percentile(samples, PERF_SAMPLES, 50);
+    ASSERT_GT(overhead, 0UL);
+    TEST_END();
+    return overhead;
+}
+
+static void test_perf_yield(uint32_t overhead)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+
+    TEST_START();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        __sys_sched_yield();
+        samples[i] = perf_get_cycle() - start;
+    }
+    perf_sub_overhead(samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("yield", "cycles", samples, PERF_SAMPLES);
+    TEST_END();
+}
+
+static void test_perf_ipc(taskh_t myself, uint32_t overhead)
+{
+    static const char *msg = "hello it's autotest";
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+
+    TEST_START();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        copy_to_kernel((uint8_t*)msg, 20);
+        __sys_send_ipc(myself, 20);
+        if (__sys_wait_for_event(EVENT_TYPE_IPC, 100L) != STATUS_OK) {
+            failures++;
+        }
+        samples[i] = perf_get_cycle() - start;
+    }
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("ipc_roundtrip", "cycles", samples, PERF_SAMPLES);
+    TEST_END();
+}
+
+static void test_perf_signal(taskh_t myself, uint32_t overhead)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+
+    TEST_START();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        __sys_send_signal(myself, SIGNAL_USR1);
+        if (__sys_wait_for_event(EVENT_TYPE_SIGNAL, 100L) != STATUS_OK) {
+            failures++;
+        }
+        samples[i] = perf_get_cycle() - start;
+    }
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("signal_roundtrip", "cycles", samples, PERF_SAMPLES);
+    TEST_END();
+}
+
+/*
+ * sleep wake-up error is the difference between the effective and the
+ * requested sleep duration. It is driven by the tick period, so it is
+ * measured in microseconds.
+ */
+static void test_perf_sleep(void)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint64_t start, stop;
+    uint32_t elapsed;
+    SleepDuration duration;
+
+    duration.tag = SLEEP_DURATION_ARBITRARY_MS;
+    duration.arbitrary_ms = 1;
+    TEST_START();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_micro();
+        __sys_sleep(duration, SLEEP_MODE_DEEP);
+        stop = perf_get_micro();
+        elapsed = (uint32_t)(stop - start);
+        /* early wake-ups are reported as a 0 error, and detected with min */
+        samples[i] = (elapsed > 1000UL) ? elapsed - 1000UL : 0;
+    }
+    PERF_REPORT("sleep_wakeup_error", "us", samples, PERF_SAMPLES);
+    TEST_END();
+}
+
+#ifdef CONFIG_TEST_SHM
+static void test_perf_shm(taskh_t myself, uint32_t overhead)
+{
+    uint32_t map_samples[PERF_SAMPLES];
+    uint32_t unmap_samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+    shmh_t shm;
+    Status res;
+
+    TEST_START();
+    res = __sys_get_shm_handle(shms[0].id);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(shm, myself, SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE);
+    ASSERT_EQ(res, STATUS_OK);
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        if (__sys_map_shm(shm) != STATUS_OK) {
+            failures++;
+        }
+        map_samples[i] = perf_get_cycle() - start;
+        start = perf_get_cycle();
+        if (__sys_unmap_shm(shm) != STATUS_OK) {
+            failures++;
+        }
+        unmap_samples[i] = perf_get_cycle() - start;
+    }
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(map_samples, PERF_SAMPLES, overhead);
+    perf_sub_overhead(unmap_samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("shm_map", "cycles", map_samples, PERF_SAMPLES);
+    PERF_REPORT("shm_unmap", "cycles", unmap_samples, PERF_SAMPLES);
+    TEST_END();
+}
+#endif
+
+#ifdef CONFIG_AUTOTEST_TIMER_DRIVER
+static void test_perf_dev(uint32_t overhead)
+{
+    uint32_t map_samples[PERF_SAMPLES];
+    uint32_t unmap_samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+    devh_t dev;
+
+    TEST_START();
+    /* get back the timer device handle from the timer driver */
+    if (timer_map(&dev) != STATUS_OK) {
+        failures++;
+    }
+    if (timer_unmap(dev) != STATUS_OK) {
+        failures++;
+    }
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        start = perf_get_cycle();
+        if (__sys_map_dev(dev) != STATUS_OK) {
+            failures++;
+        }
+        map_samples[i] = perf_get_cycle() - start;
+        start = perf_get_cycle();
+        if (__sys_unmap_dev(dev) != STATUS_OK) {
+            failures++;
+        }
+        unmap_samples[i] = perf_get_cycle() - start;
+    }
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(map_samples, PERF_SAMPLES, overhead);
+    perf_sub_overhead(unmap_samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("dev_map", "cycles", map_samples, PERF_SAMPLES);
+    PERF_REPORT("dev_unmap", "cycles", unmap_samples, PERF_SAMPLES);
+    TEST_END();
+}
+
+/*
+ * IRQ-to-userspace latency: the timer update event is software generated
+ * (UG bit), so that the interrupt is raised synchronously at a known time.
+ * The measurement include the whole path: user handler, kernel event push,
+ * election and wait_for_event() return.
+ */
+static void test_perf_irq(uint32_t overhead)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+    devh_t dev;
+
+    TEST_START();
+    if (timer_map(&dev) != STATUS_OK) {
+        failures++;
+    }
+    timer_init();
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        /* IRQ line is masked at each delivery, rearm it first */
+        timer_interrupt_acknowledge();
+        timer_enable_interrupt();
+        start = perf_get_cycle();
+        timer_restart();
+        if (__sys_wait_for_event(EVENT_TYPE_IRQ, 100L) != STATUS_OK) {
+            failures++;
+        }
+        samples[i] = perf_get_cycle() - start;
+    }
+    timer_interrupt_acknowledge();
+    timer_disable_interrupt();
+    if (timer_unmap(dev) != STATUS_OK) {
+        failures++;
+    }
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("irq_to_user", "cycles", samples, PERF_SAMPLES);
+    TEST_END();
+}
+#endif
+
+#if defined(CONFIG_TEST_DMA) && CONFIG_HAS_GPDMA
+static void test_perf_dma(taskh_t myself, uint32_t overhead)
+{
+    uint32_t samples[PERF_SAMPLES];
+    uint32_t start;
+    uint32_t failures = 0;
+    uint32_t perms = SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE;
+    shmh_t shm1, shm2;
+    dmah_t stream;
+
+    TEST_START();
+    /* memory to memory stream, between shms 0 and 1, see test_dma */
+    __sys_get_dma_stream_handle(0x2);
+    copy_from_kernel((uint8_t*)&stream, sizeof(dmah_t));
+    __sys_get_shm_handle(shms[0].id);
+    copy_from_kernel((uint8_t*)&shm1, sizeof(shmh_t));
+    __sys_get_shm_handle(shms[1].id);
+    copy_from_kernel((uint8_t*)&shm2, sizeof(shmh_t));
+    __sys_shm_set_credential(shm1, myself, perms);
+    __sys_shm_set_credential(shm2, myself, perms);
+    if ((__sys_map_shm(shm1) != STATUS_OK) || (__sys_map_shm(shm2) != STATUS_OK)) {
+        failures++;
+    }
+    for (uint32_t i = 0; i < PERF_SAMPLES; ++i) {
+        if (__sys_dma_assign_stream(stream) != STATUS_OK) {
+            failures++;
+        }
+        start = perf_get_cycle();
+        if (__sys_dma_start_stream(stream) != STATUS_OK) {
+            failures++;
+        }
+        if (__sys_wait_for_event(EVENT_TYPE_DMA, 100L) != STATUS_OK) {
+            failures++;
+        }
+        samples[i] = perf_get_cycle() - start;
+        __sys_dma_suspend_stream(stream);
+        if (__sys_dma_unassign_stream(stream) != STATUS_OK) {
+            failures++;
+        }
+    }
+    __sys_unmap_shm(shm1);
+    __sys_unmap_shm(shm2);
+    ASSERT_EQ(failures, 0UL);
+    perf_sub_overhead(samples, PERF_SAMPLES, overhead);
+    PERF_REPORT("dma_m2m_completion", "cycles", samples, PERF_SAMPLES);
+    TEST_END();
+}
+#endif
+
+void test_perf(void)
+{
+    taskh_t myself = 0;
+    uint32_t overhead;
+
+    TEST_SUITE_START("sys_perf");
+    __sys_get_process_handle(0xbabeUL);
+    copy_from_kernel((uint8_t*)&myself, sizeof(taskh_t));
+    /* rearm quantum first */
+    __sys_sched_yield();
+    overhead = test_perf_calibrate();
+    test_perf_yield(overhead);
+    test_perf_ipc(myself, overhead);
+    test_perf_signal(myself, overhead);
+    test_perf_sleep();
+#ifdef CONFIG_TEST_SHM
+    test_perf_shm(myself, overhead);
+#endif
+#ifdef CONFIG_AUTOTEST_TIMER_DRIVER
+    test_perf_dev(overhead);
+    test_perf_irq(overhead);
+#endif
+#if defined(CONFIG_TEST_DMA) && CONFIG_HAS_GPDMA
+    test_perf_dma(myself, overhead);
+#endif
+    TEST_SUITE_END("sys_perf");
+}
@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TEST_PERF_H
+#define TEST_PERF_H
+
+void test_perf(void);
+
+#endif/*!TEST_PERF_H*/
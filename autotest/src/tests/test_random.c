@@ -40,12 +40,60 @@ void test_random_duration(void)
     LOG("average get_random+copy cost: %lu", (uint32_t)((stop - start) / idx));
 }
 
+void test_random_buffer(void)
+{
+    Status ret;
+    uint8_t buf1[128];
+    uint8_t buf2[128];
+    uint32_t same = 0;
+    TEST_START();
+    ret = __sys_get_random_buffer(sizeof(buf1));
+    ASSERT_EQ(ret, STATUS_OK);
+    copy_from_kernel(buf1, sizeof(buf1));
+    ret = __sys_get_random_buffer(sizeof(buf2));
+    ASSERT_EQ(ret, STATUS_OK);
+    copy_from_kernel(buf2, sizeof(buf2));
+    for (uint32_t idx = 0; idx < sizeof(buf1); ++idx) {
+        if (buf1[idx] == buf2[idx]) {
+            same++;
+        }
+    }
+    /* two consecutive buffers must not be equal */
+    ASSERT_NE(same, (uint32_t)sizeof(buf1));
+    /* unaligned length */
+    ret = __sys_get_random_buffer(3);
+    ASSERT_EQ(ret, STATUS_OK);
+    ret = __sys_get_random_buffer(0);
+    ASSERT_EQ(ret, STATUS_INVALID);
+    ret = __sys_get_random_buffer(CONFIG_SVC_EXCHANGE_AREA_LEN + 1);
+    ASSERT_EQ(ret, STATUS_INVALID);
+    TEST_END();
+}
+
+void test_random_buffer_duration(void)
+{
+    uint64_t start, stop;
+    uint32_t idx;
+    __sys_sched_yield();
+    __sys_get_cycle(PRECISION_MICROSECONDS);
+    copy_from_kernel((uint8_t*)&start, sizeof(uint64_t));
+    for (idx = 0; idx < 100; ++idx) {
+        __sys_get_random_buffer(CONFIG_SVC_EXCHANGE_AREA_LEN);
+    }
+    __sys_get_cycle(PRECISION_MICROSECONDS);
+    copy_from_kernel((uint8_t*)&stop, sizeof(uint64_t));
+    LOG("average get_random_buffer(%u) cost: %lu", CONFIG_SVC_EXCHANGE_AREA_LEN,
+        (uint32_t)((stop - start) / idx));
+}
+
 void test_random(void)
 {
     TEST_SUITE_START("sys_get_random");
 
     test_random_sequence();
     test_random_duration();
+    test_random_buffer();
+    test_random_buffer_duration();
 
     TEST_SUITE_END("sys_get_random");
 }
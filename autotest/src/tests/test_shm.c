@@ -5,6 +5,7 @@
 #include <testlib/log.h>
 #include <testlib/assert.h>
 #include <uapi/uapi.h>
+#include <uapi/ring.h>
 #include "test_shm.h"
 
 /**
@@ -13,11 +14,12 @@
  */
 #include <shms-dt.h>
 
-static_assert(SHM_LIST_SIZE == 4, "invalid autotest SHM list");
+static_assert(SHM_LIST_SIZE == 5, "invalid autotest SHM list");
 
 #define SHM_MAP_DMAPOOL shms[0].id
 #define SHM_MAP_NODMAPOOL shms[2].id
 #define SHM_NOMAP_DMAPOOL shms[3].id
+#define SHM_MAP_RING shms[4].id
 
 /* TODO: use generated instead */
 #define SHM_MAP_DMAPOOL_BASEADDR shms[0].baseaddr
@@ -214,6 +216,440 @@ end:
     TEST_END();
 }
 
+void test_shm_cache_maintenance(void) {
+    Status res;
+    shmh_t shm;
+    uint32_t perms = (SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE);
+    TEST_START();
+    res = __sys_get_process_handle(0xbabeUL);
+    copy_from_kernel((uint8_t*)&myself, sizeof(taskh_t));
+    /* SHM_MAP_DMAPOOL is declared cacheable in autotest DTS */
+    res = __sys_get_shm_handle(SHM_MAP_DMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_map_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    if (res != STATUS_OK) {
+        goto end;
+    }
+    uint32_t* shmptr = (uint32_t*)SHM_MAP_DMAPOOL_BASEADDR;
+    for (uint32_t idx = 0; idx < (SHM_MAP_DMAPOOL_SIZE / sizeof(uint32_t)); ++idx) {
+        shmptr[idx] = idx;
+    }
+    /* written back then discarded, content must be kept */
+    res = __sys_shm_cache_clean(shm, 0, SHM_MAP_DMAPOOL_SIZE);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_cache_invalidate(shm, 0, SHM_MAP_DMAPOOL_SIZE);
+    ASSERT_EQ(res, STATUS_OK);
+    /* unaligned range, boundary lines are written back before being discarded */
+    res = __sys_shm_cache_invalidate(shm, 3, 37);
+    ASSERT_EQ(res, STATUS_OK);
+    for (uint32_t idx = 0; idx < (SHM_MAP_DMAPOOL_SIZE / sizeof(uint32_t)); ++idx) {
+        if (shmptr[idx] != idx) {
+            ASSERT_EQ(shmptr[idx], idx);
+            break;
+        }
+    }
+    /* out of SHM ranges */
+    res = __sys_shm_cache_clean(shm, 0, SHM_MAP_DMAPOOL_SIZE + 1);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_cache_clean(shm, SHM_MAP_DMAPOOL_SIZE, 1);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_cache_invalidate(shm, 0xffffffffUL, 2);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_cache_clean(shm + 42, 0, 4);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_unmap_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    /* invalidate requires write permission, clean does not */
+    perms = SHM_PERMISSION_MAP;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_cache_invalidate(shm, 0, SHM_MAP_DMAPOOL_SIZE);
+    ASSERT_EQ(res, STATUS_DENIED);
+    res = __sys_shm_cache_clean(shm, 0, SHM_MAP_DMAPOOL_SIZE);
+    ASSERT_EQ(res, STATUS_OK);
+    /* maintenance requires the map permission */
+    perms = SHM_PERMISSION_WRITE;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_cache_clean(shm, 0, SHM_MAP_DMAPOOL_SIZE);
+    ASSERT_EQ(res, STATUS_DENIED);
+    /* non-cacheable SHM, nothing to do */
+    res = __sys_get_shm_handle(SHM_MAP_NODMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    perms = SHM_PERMISSION_MAP;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_cache_clean(shm, 0, 4);
+    ASSERT_EQ(res, STATUS_OK);
+end:
+    TEST_END();
+}
+
+/*
+ * the ring SHM is not shared, so that the autotest task is both producer
+ * and consumer, and receives its own SIGNAL_POLL doorbell signals
+ */
+static Status test_shm_ring_get_signal(uint32_t *signal)
+{
+    Status res;
+    uint8_t data[4 + sizeof(exchange_event_t)];
+    exchange_event_t *header = (exchange_event_t*)&data[0];
+
+    res = __sys_wait_for_event(EVENT_TYPE_SIGNAL, WFE_WAIT_NO);
+    if (res == STATUS_OK) {
+        copy_from_kernel(data, sizeof(data));
+        *signal = *(uint32_t*)&header->data[0];
+    }
+    return res;
+}
+
+void test_shm_ring(void) {
+    Status res;
+    shmh_t shm;
+    uint32_t signal = 0;
+    uint8_t buf[128];
+    uint32_t perms = (SHM_PERMISSION_MAP | SHM_PERMISSION_READ | SHM_PERMISSION_WRITE);
+    shm_ring_t *ring = (shm_ring_t*)shms[4].baseaddr;
+    TEST_START();
+    res = __sys_get_process_handle(0xbabeUL);
+    copy_from_kernel((uint8_t*)&myself, sizeof(taskh_t));
+    res = __sys_get_shm_handle(SHM_MAP_RING);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_map_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    if (res != STATUS_OK) {
+        goto end;
+    }
+    /* 0x100 bytes SHM, 16 bytes header: 128 bytes ring, watermark set to 64 in DTS */
+    ASSERT_EQ(ring->capacity, 128);
+    ASSERT_EQ(ring->watermark, 64);
+    ASSERT_EQ(ring->head, ring->tail);
+    for (size_t i = 0; i < sizeof(buf); ++i) {
+        buf[i] = (uint8_t)i;
+    }
+    /* empty to non-empty: consumer is signaled */
+    ASSERT_EQ(shm_ring_push(ring, buf, 8), 8);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(signal, SIGNAL_POLL);
+    /* still below watermark: no signal */
+    ASSERT_EQ(shm_ring_push(ring, &buf[8], 8), 8);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_AGAIN);
+    /* watermark crossed: consumer is signaled */
+    ASSERT_EQ(shm_ring_push(ring, &buf[16], 48), 48);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(shm_ring_fill(ring), 64);
+    /* ring was not full: producer is not signaled */
+    ASSERT_EQ(shm_ring_pop(ring, buf, sizeof(buf)), 64);
+    ASSERT_EQ(buf[63], 63);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_CONSUMED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_AGAIN);
+    /* full ring, crossing the data area end, then full to non-full */
+    ASSERT_EQ(shm_ring_push(ring, buf, sizeof(buf)), 128);
+    ASSERT_EQ(shm_ring_space(ring), 0);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(shm_ring_pop(ring, buf, 1), 1);
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_CONSUMED);
+    ASSERT_EQ(res, STATUS_OK);
+    res = test_shm_ring_get_signal(&signal);
+    ASSERT_EQ(res, STATUS_OK);
+    ASSERT_EQ(signal, SIGNAL_POLL);
+    /* corrupted indexes are refused */
+    ring->head = ring->tail + 129;
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_INVALID);
+    ring->head = ring->tail;
+    /* invalid event, non-ring SHM and invalid handle */
+    res = __sys_shm_ring_doorbell(shm, 42);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_ring_doorbell(shm + 42, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_unmap_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_get_shm_handle(SHM_MAP_NODMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    res = __sys_shm_ring_doorbell(shm, SHM_RING_PRODUCED);
+    ASSERT_EQ(res, STATUS_INVALID);
+end:
+    TEST_END();
+}
+
+/*
+ * autotest is alone with idle, the SHM is then transferred from the autotest
+ * task, as owner, to itself, idle being the previous (non-mapped) user
+ */
+void test_shm_ipc_transfer(void) {
+    static const char *msg = "shm transfer";
+    Status res;
+    shmh_t shm;
+    uint8_t data[CONFIG_SVC_EXCHANGE_AREA_LEN] = {0};
+    exchange_event_t *header = (exchange_event_t*)&data[0];
+    TEST_START();
+    res = __sys_get_process_handle(0xbabeUL);
+    copy_from_kernel((uint8_t*)&myself, sizeof(taskh_t));
+    res = __sys_get_process_handle(0xcafeUL);
+    copy_from_kernel((uint8_t*)&idle, sizeof(taskh_t));
+    res = __sys_get_shm_handle(SHM_MAP_NODMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    /* flush any IPC previously sent to myself */
+    while (__sys_wait_for_event(EVENT_TYPE_IPC, WFE_WAIT_NO) == STATUS_OK) {
+        ;
+    }
+    __sys_unmap_shm(shm);
+    res = __sys_shm_set_credential(shm, myself, SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE);
+    ASSERT_EQ(res, STATUS_OK);
+    /* user credentials not transferable */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_MAP);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_to_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    res = __sys_send_ipc_shm(myself, sizeof(shmh_t), shm);
+    ASSERT_EQ(res, STATUS_DENIED);
+    res = __sys_wait_for_event(EVENT_TYPE_IPC, WFE_WAIT_NO);
+    ASSERT_EQ(res, STATUS_AGAIN);
+    /* invalid SHM handle */
+    res = __sys_send_ipc_shm(myself, sizeof(shmh_t), shm + 42);
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* transferable credentials, SHM is auto-mapped with owner credentials */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_MAP | SHM_PERMISSION_TRANSFER);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_to_kernel((uint8_t*)msg, 12);
+    res = __sys_send_ipc_shm(myself, 12, shm);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_wait_for_event(EVENT_TYPE_IPC, WFE_WAIT_NO);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_from_kernel(data, 12 + sizeof(exchange_event_t));
+    ASSERT_EQ(header->source, myself);
+    ASSERT_EQ(header->length, 12);
+    /* mapped by the transfer */
+    res = __sys_map_shm(shm);
+    ASSERT_EQ(res, STATUS_ALREADY_MAPPED);
+    *(uint32_t*)shms[2].baseaddr = 0x42UL;
+    res = __sys_unmap_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    TEST_END();
+}
+
+/*
+ * SHM_MAP_NODMAPOOL supports a single reader (outpost,max-readers), idle is
+ * declared as reader, while autotest is both owner and user
+ */
+void test_shm_readers(void) {
+    Status res;
+    shmh_t shm;
+    shmh_t shm_noreader;
+    TEST_START();
+    res = __sys_get_process_handle(0xbabeUL);
+    copy_from_kernel((uint8_t*)&myself, sizeof(taskh_t));
+    res = __sys_get_process_handle(0xcafeUL);
+    copy_from_kernel((uint8_t*)&idle, sizeof(taskh_t));
+    res = __sys_get_shm_handle(SHM_MAP_NODMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_get_shm_handle(SHM_MAP_DMAPOOL);
+    copy_from_kernel((uint8_t*)&shm_noreader, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    /* readers are read-only */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER | SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER | SHM_PERMISSION_MAP | SHM_PERMISSION_TRANSFER);
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* owner can't be a reader */
+    res = __sys_shm_set_credential(shm, myself, SHM_PERMISSION_READER | SHM_PERMISSION_MAP);
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* SHM without reader slot */
+    res = __sys_shm_set_credential(shm_noreader, idle, SHM_PERMISSION_READER | SHM_PERMISSION_MAP);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER | SHM_PERMISSION_MAP | SHM_PERMISSION_READ);
+    ASSERT_EQ(res, STATUS_OK);
+    /* updating reader creds does not consume another slot */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER | SHM_PERMISSION_MAP);
+    ASSERT_EQ(res, STATUS_OK);
+    /* a reader must be removed before being declared as user */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_MAP);
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* owner mapping is not impacted by readers */
+    res = __sys_map_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_unmap_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    /* remove reader */
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(shm, idle, SHM_PERMISSION_READER);
+    ASSERT_EQ(res, STATUS_INVALID);
+    TEST_END();
+}
+
+/*
+ * SHM_MAP_DMAPOOL is a DMA pool with the default 32 bytes blocks
+ */
+void test_shm_dma_pool(void) {
+    Status res;
+    shmh_t shm;
+    shmh_t shm_nopool;
+    uint32_t offset;
+    uint32_t offset2;
+    TEST_START();
+    res = __sys_get_shm_handle(SHM_MAP_DMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_get_shm_handle(SHM_MAP_NODMAPOOL);
+    copy_from_kernel((uint8_t*)&shm_nopool, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_dma_alloc(shm_nopool, 32);
+    ASSERT_EQ(res, STATUS_NO_ENTITY);
+    res = __sys_shm_dma_alloc(shm, 0);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_dma_alloc(shm, SHM_MAP_DMAPOOL_SIZE + 1);
+    ASSERT_EQ(res, STATUS_BUSY);
+    /* 40 bytes, 2 blocks */
+    res = __sys_shm_dma_alloc(shm, 40);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_from_kernel((uint8_t*)&offset, sizeof(uint32_t));
+    ASSERT_EQ(offset, 0);
+    res = __sys_shm_dma_alloc(shm, 4);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_from_kernel((uint8_t*)&offset2, sizeof(uint32_t));
+    ASSERT_EQ(offset2, 64);
+    /* not a buffer start */
+    res = __sys_shm_dma_free(shm, offset + 4);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_dma_free(shm, offset + 32);
+    ASSERT_EQ(res, STATUS_INVALID);
+    res = __sys_shm_dma_free(shm, offset);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_dma_free(shm, offset);
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* released blocks are reused first */
+    res = __sys_shm_dma_alloc(shm, 64);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_from_kernel((uint8_t*)&offset, sizeof(uint32_t));
+    ASSERT_EQ(offset, 0);
+    res = __sys_shm_dma_free(shm, offset);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_dma_free(shm, offset2);
+    ASSERT_EQ(res, STATUS_OK);
+    TEST_END();
+}
+
+/*
+ * copy the first half of SHM_MAP_DMAPOOL to its second half through the kernel
+ * DMA copy service
+ */
+void test_shm_copy(void) {
+    Status res;
+    shmh_t shm;
+    uint32_t perms = (SHM_PERMISSION_MAP | SHM_PERMISSION_WRITE);
+    uint32_t half = SHM_MAP_DMAPOOL_SIZE / 2;
+    shm_copy_t desc;
+    TEST_START();
+    res = __sys_get_shm_handle(SHM_MAP_DMAPOOL);
+    copy_from_kernel((uint8_t*)&shm, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_map_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+    if (res != STATUS_OK) {
+        goto end;
+    }
+    uint32_t* shmptr = (uint32_t*)SHM_MAP_DMAPOOL_BASEADDR;
+    for (uint32_t idx = 0; idx < (SHM_MAP_DMAPOOL_SIZE / sizeof(uint32_t)); ++idx) {
+        shmptr[idx] = (idx < (half / sizeof(uint32_t))) ? (0xa5a50000UL | idx) : 0;
+    }
+    desc.src = shm;
+    desc.src_offset = 0;
+    desc.dst = shm;
+    desc.dst_offset = half;
+    desc.len = half;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+#if CONFIG_DMA_KERNEL_MEMCPY
+    ASSERT_EQ(res, STATUS_OK);
+    for (uint32_t idx = 0; idx < (half / sizeof(uint32_t)); ++idx) {
+        if (shmptr[(half / sizeof(uint32_t)) + idx] != (0xa5a50000UL | idx)) {
+            ASSERT_EQ(shmptr[(half / sizeof(uint32_t)) + idx], 0xa5a50000UL | idx);
+            break;
+        }
+    }
+    /* overlapping ranges */
+    desc.dst_offset = 4;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* unaligned range */
+    desc.dst_offset = half + 2;
+    desc.len = 8;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_INVALID);
+    /* out of SHM range */
+    desc.dst_offset = half;
+    desc.len = half + 4;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_INVALID);
+#else
+    ASSERT_EQ(res, STATUS_NO_ENTITY);
+#endif
+    res = __sys_unmap_shm(shm);
+    ASSERT_EQ(res, STATUS_OK);
+#if CONFIG_DMA_KERNEL_MEMCPY
+    /* destination requires write permission */
+    perms = SHM_PERMISSION_MAP;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    desc.len = half;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_DENIED);
+    /* source and destination require the map permission */
+    perms = SHM_PERMISSION_WRITE;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_DENIED);
+    /* non-mappable DMA pools (kernel-built LLI tables) are always refused */
+    res = __sys_get_shm_handle(SHM_NOMAP_DMAPOOL);
+    copy_from_kernel((uint8_t*)&desc.dst, sizeof(shmh_t));
+    ASSERT_EQ(res, STATUS_OK);
+    res = __sys_shm_set_credential(desc.dst, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    perms = SHM_PERMISSION_MAP;
+    res = __sys_shm_set_credential(shm, myself, perms);
+    ASSERT_EQ(res, STATUS_OK);
+    desc.dst_offset = 0;
+    copy_to_kernel((uint8_t*)&desc, sizeof(shm_copy_t));
+    res = __sys_shm_copy();
+    ASSERT_EQ(res, STATUS_DENIED);
+#endif
+end:
+    TEST_END();
+}
+
 void test_shm(void) {
     TEST_SUITE_START("sys_map_shm");
     test_shm_handle();
@@ -224,6 +660,12 @@ void test_shm(void) {
     test_shm_mapdenied();
     test_shm_creds_on_mapped();
     test_shm_infos();
+    test_shm_cache_maintenance();
+    test_shm_ring();
+    test_shm_ipc_transfer();
+    test_shm_readers();
+    test_shm_dma_pool();
+    test_shm_copy();
     test_shm_allows_idle();
     TEST_SUITE_END("sys_map_shm");
 }
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <sentry/ktypes.h>
+/**
+ * \file CRC calculation unit kernel source public API, used as hardware
+ * backend of the zlib crc32(). Should be kept the same for any CRC driver.
+ */
+
+/**
+ * @def minimum buffer length, in bytes, for which the zlib crc32() uses the CRC unit
+ *
+ * Mapping the unit as kernel device costs more than a software CRC32 of a
+ * short buffer, which is computed with slicing-by-4 instead.
+ */
+#define CRC_HW_MIN_LEN 64UL
+
+kstatus_t crc_probe(void);
+
+kstatus_t crc_hw_compute(uint8_t const * buf, uint32_t len, uint32_t init, uint32_t *crc);
+
+#endif/*!CRC_H*/
@@ -48,6 +48,17 @@ kstatus_t gpdma_channel_clear_status(gpdma_stream_cfg_t const*const desc);
  */
 kstatus_t gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc, gpdma_chan_status_t * status);
 
+/**
+ * @brief poll the status of given DMA descriptor's stream, the controller being mapped once
+ *
+ * Polling stops when the transfer is complete, the stream reaches the given state
+ * or fails.
+ *
+ * @return K_ERROR_BUSY if none of these happened after max_polls status reads
+ */
+kstatus_t gpdma_channel_poll(gpdma_stream_cfg_t const*const desc, gpdma_chan_state_t state,
+                             uint32_t max_polls, gpdma_chan_status_t * status);
+
 /**
  * @brief configure a DMA channel with given DMA descriptor
  *
@@ -55,6 +66,31 @@ kstatus_t gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc, gpdma_ch
  */
 kstatus_t gpdma_channel_configure(gpdma_stream_cfg_t const*const desc);
 
+/**
+ * @def maximum size, in bytes, of the linked-list table built by gpdma_channel_link()
+ */
+#define GPDMA_LLI_TABLE_MAX_LEN 32UL
+
+/**
+ * @brief link a previously configured DMA channel to itself, in linked-list mode
+ *
+ * Build, at the given address, the linked-list table that reloads the channel
+ * at each block end, as defined by the linked_list field of the descriptor, so
+ * that the stream runs until being suspended. The table must be reachable by
+ * the DMA controller and is up to GPDMA_LLI_TABLE_MAX_LEN bytes long.
+ *
+ * @note this function do not enable the DMA channel, but only configure it
+ */
+kstatus_t gpdma_channel_link(gpdma_stream_cfg_t const*const desc, size_t lli);
+
+/**
+ * @brief set the DMA channel as privileged, so that it can reach kernel memory
+ *
+ * Channels are unprivileged at probe time, only the kernel reserved channel is
+ * privileged.
+ */
+kstatus_t gpdma_channel_set_privileged(gpdma_stream_cfg_t const*const desc);
+
 /**
  * @brief enable a previously configured DMA channel
  */
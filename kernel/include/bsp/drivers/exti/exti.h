@@ -29,6 +29,8 @@ kstatus_t exti_generate_swinterrupt(uint8_t itn);
 
 kstatus_t exti_clear_pending(uint8_t itn);
 
+kstatus_t exti_get_irqn(uint8_t itn, uint32_t *irqn);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -12,5 +12,19 @@ kstatus_t usart_probe(void);
 
 kstatus_t usart_tx(const uint8_t *data, size_t data_len);
 
+#if CONFIG_DEBUG_USART_ASYNC
+#include <stdbool.h>
+
+kstatus_t usart_tx_async_start(void);
+
+bool usart_tx_is_irq(uint32_t IRQn);
+
+void usart_tx_irq_handler(void);
+
+void usart_tx_flush(void);
+
+void usart_tx_get_dropped(uint32_t *logs, uint32_t *bytes);
+#endif
+
 
 #endif/*!USART_H*/
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef __ARCH_CACHE_H
+#define __ARCH_CACHE_H
+
+/**
+ * \file Cortex-M L1 cache maintenance
+ *
+ * Only Cortex-M7 (and later armv8.1-m cores) have an architectural L1 data cache,
+ * maintained through the SCB by-address operations. On other cores, the memory
+ * system is coherent from the core point of view (STM32 ART/ICACHE/DCACHE
+ * peripherals are not cache-maintained by the core), so that all these
+ * operations are no-op.
+ */
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <sentry/arch/asm-cortex-m/core.h>
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+# define ARCH_DCACHE_LINE_SIZE __SCB_DCACHE_LINE_SIZE
+#else
+# define ARCH_DCACHE_LINE_SIZE 32UL
+#endif
+
+/**
+ * @brief enable L1 instruction and data caches, if any
+ *
+ * Called once the MPU is configured, so that the cacheability attributes of
+ * the kernel and task regions are in place.
+ */
+/*@
+  assigns \nothing;
+ */
+__STATIC_FORCEINLINE void arch_cache_enable(void)
+{
+#ifndef __FRAMAC__
+# if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+    SCB_EnableICache();
+# endif
+# if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_EnableDCache();
+# endif
+#endif
+}
+
+/**
+ * @brief write back the dirty data cache lines of the given memory area
+ *
+ * to be used before a bus master (DMA) reads memory written by the core.
+ */
+/*@
+  assigns \nothing;
+ */
+__STATIC_FORCEINLINE void arch_dcache_clean_range(size_t addr, size_t len)
+{
+#if !defined(__FRAMAC__) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if (len != 0) {
+        SCB_CleanDCache_by_Addr((void *)addr, (int32_t)len);
+    }
+#endif
+}
+
+/**
+ * @brief discard the data cache lines of the given memory area
+ *
+ * to be used after a bus master (DMA) wrote memory read by the core.
+ * Cache maintenance is made by line, so that partial first and last lines
+ * may also hold data outside of the given area. These are cleaned and
+ * invalidated, so that data written by the core next to the area is never
+ * lost.
+ */
+/*@
+  assigns \nothing;
+ */
+__STATIC_FORCEINLINE void arch_dcache_invalidate_range(size_t addr, size_t len)
+{
+#if !defined(__FRAMAC__) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    size_t start = addr & ~(ARCH_DCACHE_LINE_SIZE - 1UL);
+    size_t end = addr + len;
+    size_t end_aligned = end & ~(ARCH_DCACHE_LINE_SIZE - 1UL);
+
+    if (len == 0) {
+        goto end;
+    }
+    if (start != addr) {
+        SCB_CleanInvalidateDCache_by_Addr((void *)start, ARCH_DCACHE_LINE_SIZE);
+        start += ARCH_DCACHE_LINE_SIZE;
+    }
+    if ((end_aligned != end) && (end_aligned >= start)) {
+        SCB_CleanInvalidateDCache_by_Addr((void *)end_aligned, ARCH_DCACHE_LINE_SIZE);
+    }
+    if (end_aligned > start) {
+        SCB_InvalidateDCache_by_Addr((void *)start, (int32_t)(end_aligned - start));
+    }
+end:
+    return;
+#endif
+}
+
+#endif/*!__ARCH_CACHE_H*/
@@ -224,6 +224,35 @@ __STATIC_FORCEINLINE uint32_t mpu_convert_size_to_region(uint32_t size)
     return __mpu_size_to_region(size);
 }
 
+/**
+ * @brief set the address, size and subregion mask of a region descriptor
+ *
+ * The region maps at least [addr, addr + size[. When supported and enabled
+ * (PMSAv7 subregions), non power of two areas are mapped tightly, otherwise
+ * the area size is rounded up to the MPU region size constraint.
+ */
+/*@
+  requires \valid(desc);
+  assigns desc->addr, desc->size, desc->mask;
+ */
+__STATIC_FORCEINLINE void mpu_set_region_layout(struct mpu_region_desc *desc,
+                                                uint32_t addr,
+                                                uint32_t size)
+{
+#if CONFIG_MPU_PMSA_V7_SUBREGIONS
+    if (likely(__mpu_region_pack(addr, size, desc) == K_STATUS_OKAY)) {
+        goto end;
+    }
+#endif
+    desc->addr = addr;
+    desc->size = mpu_convert_size_to_region(size);
+    desc->mask = 0x0;
+#if CONFIG_MPU_PMSA_V7_SUBREGIONS
+end:
+#endif
+    return;
+}
+
 /**
  * Load memory regions description table in MPU
  */
@@ -205,7 +205,61 @@ __STATIC_FORCEINLINE secure_bool_t __mpu_is_resource_free(const layout_resource_
  */
 __STATIC_FORCEINLINE uint32_t __mpu_get_resource_base_address(const layout_resource_t *resource)
 {
-    return resource->RBAR & MPU_RBAR_ADDR_Msk;
+    uint32_t addr = resource->RBAR & MPU_RBAR_ADDR_Msk;
+#if CONFIG_MPU_PMSA_V7_SUBREGIONS
+    uint32_t srd = (resource->RASR & MPU_RASR_SRD_Msk) >> MPU_RASR_SRD_Pos;
+
+    if (srd != 0UL) {
+        /* mapped area starts at the first enabled subregion */
+        uint32_t size = 1UL << (((resource->RASR & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos) + 1UL);
+        addr += (size >> 3) * (uint32_t)__builtin_ctz(~srd);
+    }
+#endif
+    return addr;
+}
+
+/**
+ * @brief check if the given address is mapped by the given resource
+ *
+ * Disabled subregions are not considered as mapped.
+ */
+/*@
+   requires \valid_read(resource);
+   assigns \nothing;
+ */
+__STATIC_FORCEINLINE secure_bool_t __mpu_resource_contains(const layout_resource_t *resource, uint32_t addr)
+{
+    secure_bool_t res = SECURE_FALSE;
+    uint32_t base = resource->RBAR & MPU_RBAR_ADDR_Msk;
+    uint64_t size = 1ULL << (((resource->RASR & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos) + 1UL);
+    uint32_t srd = (resource->RASR & MPU_RASR_SRD_Msk) >> MPU_RASR_SRD_Pos;
+
+    if ((resource->RASR & MPU_RASR_ENABLE_Msk) == 0UL) {
+        goto end;
+    }
+    if ((addr < base) || ((uint64_t)(addr - base) >= size)) {
+        goto end;
+    }
+    if ((size >= 256ULL) && ((srd & (1UL << ((addr - base) / (size >> 3)))) != 0UL)) {
+        goto end;
+    }
+    res = SECURE_TRUE;
+end:
+    return res;
+}
+
+/**
+ * @brief set the MPU region number a resource is loaded to
+ *
+ * @note for PMSAv7, the region number is encoded in the RBAR register value
+ */
+/*@
+   requires \valid(resource);
+   assigns resource->RBAR;
+ */
+__STATIC_FORCEINLINE void __mpu_resource_set_region(layout_resource_t *resource, uint8_t region_id)
+{
+    resource->RBAR = ARM_MPU_RBAR(region_id, resource->RBAR & MPU_RBAR_ADDR_Msk);
 }
 
 /**
@@ -250,6 +304,82 @@ __STATIC_FORCEINLINE uint32_t __mpu_size_to_region(uint32_t size)
     return shift - 1;
 }
 
+#if CONFIG_MPU_PMSA_V7_SUBREGIONS
+/**
+ * @brief PMSAv7 subregion based region layout
+ *
+ * Look for the smallest region that maps [addr, addr + size[ using its enabled
+ * subregions. A region is split into 8 subregions of 1/8 of its size, for regions
+ * of at least 256 bytes, so that the memory area must be aligned on the subregion
+ * size and must not cross the region boundary. The area size is rounded up to the
+ * subregion size.
+ *
+ * This is the very same algorithm as the tools/mpupack.py build-time placement.
+ *
+ * @param[in] addr: memory area start address
+ * @param[in] size: memory area size
+ * @param[out] desc: region descriptor whose addr, size and mask fields are set
+ *
+ * @return K_ERROR_INVPARAM if the area can't be mapped with subregions, in that
+ *  case desc is not modified, K_STATUS_OKAY otherwise
+ */
+/*@
+   requires \valid(desc);
+   assigns desc->addr, desc->size, desc->mask;
+ */
+__STATIC_FORCEINLINE kstatus_t __mpu_region_pack(uint32_t addr, uint32_t size,
+                                                 struct mpu_region_desc *desc)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    uint64_t end;
+
+    if (unlikely(size < 32UL)) {
+        size = 32UL;
+    }
+    end = (uint64_t)addr + size;
+    /*@
+      loop invariant 5 <= shift <= 32;
+      loop assigns shift, status, desc->addr, desc->size, desc->mask;
+      loop variant 32 - shift;
+     */
+    for (uint32_t shift = 5; shift < 32; ++shift) {
+        uint64_t region = 1ULL << shift;
+        uint64_t sub = region >> 3;
+        uint64_t base = addr & ~(region - 1ULL);
+        uint32_t first;
+        uint32_t last;
+
+        if (shift < 8) {
+            /* no subregion below 256 bytes */
+            if ((base == addr) && (end <= (base + region))) {
+                desc->addr = addr;
+                desc->size = shift - 1;
+                desc->mask = 0x0;
+                status = K_STATUS_OKAY;
+                break;
+            }
+            continue;
+        }
+        if ((addr & (sub - 1ULL)) != 0) {
+            /* subregions only get bigger, no possible mapping */
+            break;
+        }
+        if (end > (base + region)) {
+            continue;
+        }
+        first = (uint32_t)((addr - base) / sub);
+        last = (uint32_t)((end - base + sub - 1ULL) / sub);
+        desc->addr = (uint32_t)base;
+        desc->size = shift - 1;
+        /* disable subregions out of [first, last[ */
+        desc->mask = (uint8_t)~(((1UL << last) - 1UL) & ~((1UL << first) - 1UL));
+        status = K_STATUS_OKAY;
+        break;
+    }
+    return status;
+}
+#endif
+
 /*@
   // TODO: get back local SoC max RNR to control region_id value
   requires \valid_read(resource);
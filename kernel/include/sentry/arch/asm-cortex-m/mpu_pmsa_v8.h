@@ -25,7 +25,8 @@
 #define _MPU_PERM_P  0
 #define _MPU_PERM_NP 1
 
-#define _MPU_ATTR_CACHE_WB_RA ARM_MPU_ATTR_MEMORY_(0, 1, 1, 0)
+/* non-transient, write-back, read allocate, no write allocate */
+#define _MPU_ATTR_CACHE_WB_RA ARM_MPU_ATTR_MEMORY_(1, 1, 1, 0)
 
 /** MPU Access Permission privileged access only */
 #define MPU_REGION_PERM_PRIV ARM_MPU_AP_(_MPU_PERM_RW, _MPU_PERM_P)
@@ -141,7 +142,7 @@ __STATIC_FORCEINLINE void __mpu_initialize(void)
         /** MPU Access attribute for non cached normal memory */
         ARM_MPU_ATTR(ARM_MPU_ATTR_NON_CACHEABLE, ARM_MPU_ATTR_NON_CACHEABLE),
         /** MPU Access attribute for cached normal memory w/ write back and read allocate cache policy */
-        ARM_MPU_ATTR(ARM_MPU_ATTR_NON_CACHEABLE, ARM_MPU_ATTR_NON_CACHEABLE),
+        ARM_MPU_ATTR(_MPU_ATTR_CACHE_WB_RA, _MPU_ATTR_CACHE_WB_RA),
     };
 
     static_assert(ARRAY_SIZE(_mpu_attrs) <= 8, "PMSAv8 MPU attribute array size too big");
@@ -203,6 +204,38 @@ __STATIC_FORCEINLINE kstatus_t mpu_forge_resource(const struct mpu_region_desc *
     return status;
 }
 
+#ifndef __FRAMAC__
+/**
+ * @brief copy two regions to consecutive RBAR/RLAR alias registers, using a single
+ * 4 words LDM/STM burst
+ */
+__STATIC_FORCEINLINE void __mpu_alias_burst2(volatile uint32_t *dst, const layout_resource_t *src)
+{
+    asm volatile (
+        "ldmia %1, {r4-r7}\n\t"
+        "stmia %0, {r4-r7}\n\t"
+        :
+        : "r" (dst), "r" (src)
+        : "r4", "r5", "r6", "r7", "memory"
+    );
+}
+
+/**
+ * @brief copy one region to a RBAR/RLAR alias registers pair, using a single
+ * 2 words LDM/STM burst
+ */
+__STATIC_FORCEINLINE void __mpu_alias_burst1(volatile uint32_t *dst, const layout_resource_t *src)
+{
+    asm volatile (
+        "ldmia %1, {r4-r5}\n\t"
+        "stmia %0, {r4-r5}\n\t"
+        :
+        : "r" (dst), "r" (src)
+        : "r4", "r5", "memory"
+    );
+}
+#endif
+
 /**
  * @brief PMSAv8 MPU region fastload
  *
@@ -211,9 +244,12 @@ __STATIC_FORCEINLINE kstatus_t mpu_forge_resource(const struct mpu_region_desc *
  * @param num_resources number of resources to (fast) load
  *
  * @note for PMSAv8, resource ID must be written before setting MPU region RBAR/RLAR.
- * In case of fast loading, write RNR reg to the first region number, fast load up
- * to 4 region, refresh RNR, write next 4 regions and so one. This is handle by CMSIS
- * intrinsics.
+ * RBAR/RLAR and their RBAR_A[1-3]/RLAR_A[1-3] aliases are contiguous, so that up to
+ * MPU_TYPE_RALIASES regions are written per RNR selection. As the layout table
+ * holds RBAR/RLAR pairs in region order, it is already in alias order and is copied
+ * using LDM/STM bursts of two regions. This function is called with build-time
+ * constant arguments, so that the loops are fully unrolled into RNR writes and
+ * bursts only, unlike the generic CMSIS ARM_MPU_Load() word by word copy.
  */
 /*@
   requires \valid_read(resource + (0 .. num_resources-1));
@@ -226,7 +262,37 @@ __STATIC_FORCEINLINE void __mpu_fastload(
     uint8_t num_resources
 )
 {
+#ifndef __FRAMAC__
+    uint32_t rnr = first_region_number & ~(MPU_TYPE_RALIASES - 1UL);
+    uint32_t alias = first_region_number & (MPU_TYPE_RALIASES - 1UL);
+    uint32_t remaining = num_resources;
+
+    while (remaining > 0UL) {
+        uint32_t count = MPU_TYPE_RALIASES - alias;
+        /* RBAR, RLAR, RBAR_A1, RLAR_A1... are contiguous */
+        volatile uint32_t *dst = &MPU->RBAR + (alias * 2UL);
+
+        if (count > remaining) {
+            count = remaining;
+        }
+        remaining -= count;
+        MPU->RNR = rnr;
+        while (count >= 2UL) {
+            __mpu_alias_burst2(dst, resource);
+            dst += 4;
+            resource += 2;
+            count -= 2UL;
+        }
+        if (count != 0UL) {
+            __mpu_alias_burst1(dst, resource);
+            resource++;
+        }
+        rnr += MPU_TYPE_RALIASES;
+        alias = 0UL;
+    }
+#else
     ARM_MPU_Load(first_region_number, resource, num_resources);
+#endif
 }
 
 /*@
@@ -253,6 +319,41 @@ __STATIC_FORCEINLINE uint32_t __mpu_get_resource_base_address(const layout_resou
     return resource->RBAR & MPU_RBAR_BASE_Msk;
 }
 
+/**
+ * @brief check if the given address is mapped by the given resource
+ */
+/*@
+   requires \valid_read(resource);
+   assigns \nothing;
+ */
+__STATIC_FORCEINLINE secure_bool_t __mpu_resource_contains(const layout_resource_t *resource, uint32_t addr)
+{
+    secure_bool_t res = SECURE_FALSE;
+    uint32_t base = resource->RBAR & MPU_RBAR_BASE_Msk;
+    uint32_t limit = (resource->RLAR & MPU_RLAR_LIMIT_Msk) | (_PMSAv8_MEM_ALIGNMENT - 1UL);
+
+    if (((resource->RLAR & MPU_RLAR_EN_Msk) != 0UL) && (addr >= base) && (addr <= limit)) {
+        res = SECURE_TRUE;
+    }
+    return res;
+}
+
+/**
+ * @brief set the MPU region number a resource is loaded to
+ *
+ * @note for PMSAv8, the region number is the resource position in the
+ * loaded layout, nothing to do
+ */
+/*@
+   assigns \nothing;
+ */
+__STATIC_FORCEINLINE void __mpu_resource_set_region(
+    layout_resource_t *resource __attribute__((unused)),
+    uint8_t region_id __attribute__((unused))
+)
+{
+}
+
 /**
  * @brief PMSAv8 MPU region size alignment
  * @param size memory size to map
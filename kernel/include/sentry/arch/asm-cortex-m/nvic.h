@@ -146,6 +146,30 @@ kstatus_t     nvic_clear_pendingirq(uint32_t IRQn);
  */
 uint32_t nvic_get_active(uint32_t IRQn);
 
+/*@
+
+  behavior invalid_irq:
+    assumes IRQn < MEMMANAGE_IRQ || IRQn >= (int32_t)NUM_IRQS;
+    assigns \nothing;
+    ensures \result == K_ERROR_INVPARAM;
+
+  behavior invalid_prio:
+    assumes IRQn >= MEMMANAGE_IRQ && IRQn < (int32_t)NUM_IRQS;
+    assumes priority >= (1UL << __NVIC_PRIO_BITS);
+    assigns \nothing;
+    ensures \result == K_ERROR_INVPARAM;
+
+  behavior valid_irq:
+    assumes IRQn >= MEMMANAGE_IRQ && IRQn < (int32_t)NUM_IRQS;
+    assumes priority < (1UL << __NVIC_PRIO_BITS);
+    assigns *NVIC, *SCB;
+    ensures \result == K_STATUS_OKAY;
+
+  complete behaviors;
+  disjoint behaviors;
+ */
+kstatus_t nvic_set_priority(int32_t IRQn, uint32_t priority);
+
 
 void     nvic_systemreset(void);
 
@@ -156,6 +180,31 @@ kstatus_t     interrupt_disable_irq(uint32_t IRQn);
 uint32_t      interrupt_get_pending_irq(uint32_t IRQn);
 kstatus_t     interrupt_set_pending_irq(uint32_t IRQn);
 kstatus_t     interrupt_clear_pendingirq(uint32_t IRQn);
+kstatus_t     interrupt_set_priority(int32_t IRQn, uint32_t priority);
+
+/**
+ * @def lowest priority level supported by the interrupt controller
+ */
+#define INTERRUPT_LOWEST_PRIORITY ((1UL << __NVIC_PRIO_BITS) - 1UL)
+
+#if CONFIG_KERNEL_BASEPRI_MASKING
+/**
+ * @def priority level of kernel handled exceptions and non-critical interrupts
+ */
+#define INTERRUPT_KERNEL_PRIORITY CONFIG_KERNEL_BASEPRI_LEVEL
+
+/**
+ * @def BASEPRI register value masking the kernel priority level and below
+ *
+ * Only the __NVIC_PRIO_BITS upper bits of the priority byte are implemented.
+ * This value is also used as an assembly immediate, keep it a pure literal
+ * expression.
+ */
+#define INTERRUPT_KERNEL_BASEPRI (CONFIG_KERNEL_BASEPRI_LEVEL << (8 - __NVIC_PRIO_BITS))
+
+static_assert(INTERRUPT_KERNEL_PRIORITY < INTERRUPT_LOWEST_PRIORITY,
+              "kernel priority level must be higher than PendSV one");
+#endif
 
 /* arch-genric API */
 /*@
@@ -219,6 +268,40 @@ static inline void interrupt_enable(void) {
     return;
 }
 
+/**
+ * @brief request a deferred context switch
+ *
+ * Pend the PendSV exception. As PendSV is configured with the lowest priority,
+ * the context switch is executed once all other pending handlers are
+ * terminated (tail-chaining), whatever the number of requests emitted in the
+ * meantime.
+ */
+/*@
+  assigns ((SCB_Type*)SCB_BASE)->ICSR;
+ */
+static inline void interrupt_request_context_switch(void) {
+#ifndef __FRAMAC__
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    arch_data_sync_barrier();
+#endif
+}
+
+/**
+ * @brief clear a pending deferred context switch request
+ *
+ * Used at PendSV time when the election is about to be executed synchronously,
+ * so that requests emitted in the meantime do not trigger a spurious PendSV.
+ */
+/*@
+  assigns ((SCB_Type*)SCB_BASE)->ICSR;
+ */
+static inline void interrupt_clear_context_switch(void) {
+#ifndef __FRAMAC__
+    SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+    arch_data_sync_barrier();
+#endif
+}
+
 /*@
   requires __NVIC_VECTOR_LEN <= NVIC_MAX_ALLOWED_IRQS;
   assigns *NVIC;
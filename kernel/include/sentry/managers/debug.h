@@ -10,6 +10,7 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <sentry/ktypes.h>
+#include <uapi/types.h>
 #if CONFIG_BUILD_TARGET_AUTOTEST
 #include <sentry/arch/asm-generic/tick.h>
 #endif
@@ -117,12 +118,33 @@ kstatus_t printk(const char* fmt, ...);
  */
 #define pr_fmt(fmt) "%s: " fmt COLOR_RESET "\n", __func__
 
+#if CONFIG_DEBUG_BINARY_LOG
+/**
+ * binary log record queuing, fmt must be located in the .logfmt section
+ */
+kstatus_t binlog_emit(const char *fmt, ...);
+
+/**
+ * @def pr_xxx output primitive, not to be used directly. The call site format
+ * string is stored in the .logfmt section, so that only its identifier is
+ * emitted, with the raw arguments
+ */
+#define __pr_binlog(fmt, ...) ({ \
+    static const char __binlog_fmt[] __attribute__((section(".logfmt"), used)) = fmt; \
+    binlog_emit(__binlog_fmt, ##__VA_ARGS__); \
+})
+/* arguments are expanded first, so that pr_fmt() format and __func__ are split */
+#define __pr_printk(...) __pr_binlog(__VA_ARGS__)
+#else
+#define __pr_printk(...) printk(__VA_ARGS__)
+#endif
+
 #if CONFIG_DEBUG_LEVEL > 0
 /**
  * @def emergency messages, the system do not work correctly anymore
  */
 #define pr_emerg(fmt, ...) \
-	printk(COLOR_RED KERN_EMERG " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_RED KERN_EMERG " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_emerg(fmt, ...)
 #endif
@@ -132,7 +154,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def alert message, the system is in alert mode, even if it may no be unstable
  */
 #define pr_alert(fmt, ...) \
-	printk(COLOR_RED KERN_ALERT " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_RED KERN_ALERT " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_alert(fmt, ...)
 #endif
@@ -142,7 +164,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def critical error of any module
  */
 #define pr_crit(fmt, ...) \
-	printk(COLOR_RED KERN_CRIT " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_RED KERN_CRIT " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_crit(fmt, ...)
 #endif
@@ -152,7 +174,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def something went wrong somewhere
  */
 #define pr_err(fmt, ...) \
-	printk(COLOR_RED KERN_ERR " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_RED KERN_ERR " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_err(fmt, ...)
 #endif
@@ -162,7 +184,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def warning information about anything (fallbacking, etc...)
  */
 #define pr_warn(fmt, ...) \
-	printk(COLOR_PURPLE KERN_WARNING " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_PURPLE KERN_WARNING " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_warn(fmt, ...)
 #endif
@@ -172,7 +194,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def notice on something that is a little tricky, but not a warning though
  */
 #define pr_notice(fmt, ...) \
-	printk(COLOR_PURPLE KERN_NOTICE " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_PURPLE KERN_NOTICE " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_notice(fmt, ...)
 #endif
@@ -182,7 +204,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def usual informational messages
  */
 #define pr_info(fmt, ...) \
-	printk(COLOR_BLUE KERN_INFO " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_BLUE KERN_INFO " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_info(fmt, ...)
 #endif
@@ -192,7 +214,7 @@ kstatus_t printk(const char* fmt, ...);
  * @def debugging messages, may generates a lot of output or performances impacts
  */
 #define pr_debug(fmt, ...) \
-	printk(COLOR_GREEN KERN_DEBUG " " pr_fmt(fmt), ##__VA_ARGS__)
+	__pr_printk(COLOR_GREEN KERN_DEBUG " " pr_fmt(fmt), ##__VA_ARGS__)
 #else
 #define pr_debug(fmt, ...)
 #endif
@@ -222,6 +244,124 @@ kstatus_t mgr_debug_autotest(void);
 #endif/*autotest */
 
 
+#ifdef CONFIG_BUILD_TARGET_RELEASE
+/* in release mode, no kernel statistic is recorded */
+static inline void mgr_debug_kstat_record(uint32_t stat __attribute__((unused)),
+                                          uint32_t index __attribute__((unused)),
+                                          uint32_t cycles __attribute__((unused))) {
+    return;
+}
+
+static inline kstatus_t mgr_debug_kstat_get(uint32_t stat __attribute__((unused)),
+                                            uint32_t index __attribute__((unused)),
+                                            kernel_stat_infos_t *infos __attribute__((unused))) {
+    return K_ERROR_NOENT;
+}
+#else
+/**
+ * @def number of per-syscall statistics slots, must be greater or equal to the
+ * syscall LUT size
+ */
+#define KSTAT_SYSCALL_NUM 64UL
+
+/**
+ * record a new value, in cycles, for a given kernel statistic
+ */
+void mgr_debug_kstat_record(uint32_t stat, uint32_t index, uint32_t cycles);
+
+/**
+ * get back a copy of a given kernel statistic
+ */
+kstatus_t mgr_debug_kstat_get(uint32_t stat, uint32_t index, kernel_stat_infos_t *infos);
+#endif
+
+#if CONFIG_DEBUG_IRQ_PROBE
+#include <uapi/handle.h>
+
+/**
+ * arm the EXTI latency probe for the given owner, triggered after the given
+ * number of ticks (0: immediately)
+ */
+kstatus_t mgr_debug_irqprobe_arm(taskh_t owner, uint32_t ticks);
+
+/**
+ * probe delayed trigger management, to be called at each systick
+ */
+void mgr_debug_irqprobe_tick(void);
+
+/**
+ * return SECURE_TRUE if IRQn is the probe interrupt line
+ */
+secure_bool_t mgr_debug_irqprobe_is_probe(uint32_t IRQn);
+
+/**
+ * probe interrupt kernel handler, return the owner to deliver the interrupt to
+ */
+kstatus_t mgr_debug_irqprobe_handler(uint32_t IRQn, taskh_t *owner);
+
+/**
+ * probe interrupt delivered to its owner through wait_for_event()
+ */
+void mgr_debug_irqprobe_delivered(uint32_t IRQn);
+#endif
+
+#if CONFIG_DEBUG_USART_ASYNC
+/**
+ * switch to asynchronous log output, logs are synchronous until then
+ */
+kstatus_t mgr_debug_async_start(void);
+
+/**
+ * return SECURE_TRUE if IRQn is the asynchronous log output interrupt
+ */
+secure_bool_t mgr_debug_is_log_irq(uint32_t IRQn);
+
+/**
+ * asynchronous log output interrupt kernel handler
+ */
+void mgr_debug_log_irq_handler(void);
+#endif
+
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+/**
+ * synchronously emit pending logs
+ */
+void mgr_debug_flush(void);
+
+/**
+ * emit a bounded amount of pending logs, called when idle is scheduled
+ */
+void mgr_debug_idle(void);
+#endif
+
+#if CONFIG_DEBUG_BINARY_LOG
+/**
+ * emit queued binary log records, whole records only, at least one
+ */
+secure_bool_t mgr_debug_binlog_drain(size_t max);
+
+/**
+ * periodic bounded emission of the queued binary log records, to be called at each systick
+ */
+void mgr_debug_binlog_tick(void);
+#endif
+
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+/**
+ * queue a userspace log, emitted later on the debug output
+ */
+kstatus_t mgr_debug_userlog_push(uint32_t label, const uint8_t *log, size_t len);
+
+/**
+ * emit at most max bytes of the queued userspace logs
+ */
+secure_bool_t mgr_debug_userlog_drain(size_t max);
+
+/**
+ * periodic bounded emission of the queued userspace logs, to be called at each systick
+ */
+void mgr_debug_userlog_tick(void);
+#endif
 
 kstatus_t mgr_debug_init(void);
 
@@ -41,6 +41,8 @@ kstatus_t mgr_device_autotest(void);
 
 kstatus_t mgr_device_get_devh_from_interrupt(uint16_t IRQn, devh_t *devh);
 
+kstatus_t mgr_device_get_owner_from_interrupt(uint16_t IRQn, devh_t *devh, taskh_t *owner);
+
 /**
  * Iterate over the device list, starting with id==id.
  * Return the devinfo of the current id increment, or set devinfo to NULL and return K_ERROR_NOENT if
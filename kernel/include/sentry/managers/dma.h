@@ -5,6 +5,7 @@
 #define SENTRY_MANAGERS_DMA_H
 
 #include <inttypes.h>
+#include <string.h>
 #include <uapi/handle.h>
 #include <uapi/dma.h>
 #include <sentry/ktypes.h>
@@ -16,13 +17,7 @@ extern "C" {
 
 #if CONFIG_HAS_GPDMA
 
-__STATIC_FORCEINLINE bool mgr_dma_is_irq_owned(int IRQn) {
-    bool dma_owned = false;
-#ifdef CONFIG_HAS_GPDMA
-    dma_owned = gpdma_irq_is_dma_owned(IRQn);
-#endif
-return dma_owned;
-}
+bool mgr_dma_is_irq_owned(uint16_t IRQn);
 
 kstatus_t mgr_dma_init(void);
 
@@ -55,9 +50,57 @@ kstatus_t mgr_dma_stream_resume(const dmah_t dmah);
 
 kstatus_t mgr_dma_treat_chan_event(const dmah_t dmah);
 
+#if CONFIG_DMA_KERNEL_MEMCPY
+kstatus_t mgr_dma_kernel_copy_init(void);
+
+kstatus_t mgr_dma_kernel_memcpy(size_t dest, size_t src, size_t len);
+
+kstatus_t mgr_dma_kernel_memzero(size_t dest, size_t len);
+#endif
 
 #endif/* HAS_GPDMA */
 
+/**
+ * @brief kernel memory copy, offloaded to the kernel DMA channel when possible
+ *
+ * Word aligned copies of at least CONFIG_DMA_KERNEL_MEMCPY_THRESHOLD bytes are
+ * executed by the DMA, others (or if the DMA is not ready) by the CPU.
+ */
+static inline void mgr_dma_memcpy(void *dest, void const *src, size_t len)
+{
+#if CONFIG_DMA_KERNEL_MEMCPY
+    if ((len >= CONFIG_DMA_KERNEL_MEMCPY_THRESHOLD) &&
+        (mgr_dma_kernel_memcpy((size_t)dest, (size_t)src, len) == K_STATUS_OKAY)) {
+        goto end;
+    }
+#endif
+    memcpy(dest, src, len);
+#if CONFIG_DMA_KERNEL_MEMCPY
+end:
+#endif
+    return;
+}
+
+/**
+ * @brief kernel memory zero-fill, offloaded to the kernel DMA channel when possible
+ *
+ * @see mgr_dma_memcpy()
+ */
+static inline void mgr_dma_memzero(void *dest, size_t len)
+{
+#if CONFIG_DMA_KERNEL_MEMCPY
+    if ((len >= CONFIG_DMA_KERNEL_MEMCPY_THRESHOLD) &&
+        (mgr_dma_kernel_memzero((size_t)dest, len) == K_STATUS_OKAY)) {
+        goto end;
+    }
+#endif
+    memset(dest, 0x0, len);
+#if CONFIG_DMA_KERNEL_MEMCPY
+end:
+#endif
+    return;
+}
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -34,6 +34,22 @@ kstatus_t mgr_interrupt_disable_irq(uint32_t irq);
 
 kstatus_t mgr_interrupt_acknowledge_irq(uint32_t irq);
 
+#if CONFIG_KERNEL_BASEPRI_MASKING
+/**
+ * Kernel bypass entry for critical interrupts, called from the exception entry
+ * before any kernel context save. Returns non-zero if the interrupt has been
+ * handled (critical interrupt), 0 if the nominal kernel path must be executed.
+ */
+uint32_t critisr_handler(uint32_t ipsr);
+
+/**
+ * Deliver to their owner all the critical interrupts received since the last call
+ */
+uint32_t mgr_interrupt_critical_flush(void);
+
+kstatus_t mgr_interrupt_set_priority(uint32_t irq, uint32_t priority);
+#endif
+
 #ifdef CONFIG_BUILD_TARGET_AUTOTEST
 kstatus_t mgr_interrupt_autotest(void);
 #endif
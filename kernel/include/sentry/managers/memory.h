@@ -24,7 +24,10 @@ extern "C" {
 typedef enum mm_region {
     MM_REGION_TASK_TXT = TASK_FIRST_REGION_NUMBER, /* starting point of userspace ressources */
     MM_REGION_TASK_DATA = TASK_FIRST_REGION_NUMBER + 1,
-    MM_REGION_TASK_RESSOURCE_DEVICE, /* starting at 4, no fixed order */
+#if CONFIG_MM_KINFO_PAGE
+    MM_REGION_TASK_KINFO, /* kernel information page, read-only */
+#endif
+    MM_REGION_TASK_RESSOURCE_DEVICE, /* starting at 4 (5 with kinfo page), no fixed order */
     MM_REGION_TASK_RESSOURCE_SHM,
 } mm_region_t;
 
@@ -78,6 +81,33 @@ kstatus_t mgr_mm_map_device(taskh_t tsk, devh_t dev);
  */
 kstatus_t mgr_mm_unmap_device(taskh_t tsk, devh_t dev);
 
+/**
+ * Data cache maintenance (write back, discard) of a memory area, typically a
+ * DMA-accessed cacheable shared memory
+ */
+kstatus_t mgr_mm_dcache_clean(size_t addr, size_t len);
+
+kstatus_t mgr_mm_dcache_invalidate(size_t addr, size_t len);
+
+#if CONFIG_MM_REGION_CACHE
+/**
+ * Load a mapped but not loaded resource on MemManage fault (software MPU region cache)
+ */
+kstatus_t mgr_mm_region_cache_refill(taskh_t t, uint32_t addr);
+#endif
+
+#if CONFIG_MM_KINFO_PAGE
+/**
+ * Kernel information page, mapped read-only in all tasks (see uapi/kinfo.h)
+ */
+void mgr_mm_kinfo_init(void);
+
+void mgr_mm_kinfo_add_task(uint32_t label, taskh_t handle);
+
+void mgr_mm_kinfo_tick(uint64_t jiffies, uint64_t cycles);
+
+size_t mgr_mm_kinfo_get_page(void);
+#endif
 
 kstatus_t mgr_mm_forge_ressource(mm_region_t reg_type, taskh_t t, layout_resource_t *ressource);
 
@@ -87,8 +117,11 @@ typedef enum shm_user {
     SHM_TSK_OWNER,
     SHM_TSK_USER,
     SHM_TSK_NONE,
+    SHM_TSK_READER, /**< first read-only reader, reader n is SHM_TSK_READER + n */
 } shm_user_t;
 
+#define SHM_TSK_IS_READER(accessor) ((accessor) >= SHM_TSK_READER)
+
 /**
  * shared memory per-user configuration. This config is set by the owner for both.
  * at boot time, all fields are set to SECURE_FALSE
@@ -103,6 +136,8 @@ kstatus_t mgr_mm_map_shm(taskh_t tsk, shmh_t shm);
 
 kstatus_t mgr_mm_unmap_shm(taskh_t tsk, shmh_t shm);
 
+kstatus_t mgr_mm_shm_transfer(shmh_t shm, taskh_t from, taskh_t to);
+
 /* global SHM properties relative requests */
 
 kstatus_t mgr_mm_shm_is_mappable_by(shmh_t shm, shm_user_t tsk, secure_bool_t *result);
@@ -117,6 +152,11 @@ kstatus_t mgr_mm_shm_get_size(shmh_t shm, size_t *size);
 
 kstatus_t mgr_mm_shm_get_label(shmh_t shm, uint32_t *label);
 
+kstatus_t mgr_mm_shm_is_cacheable(shmh_t shm, secure_bool_t *result);
+
+kstatus_t mgr_mm_shm_ring_doorbell(shmh_t shm, shm_user_t accessor, uint32_t event,
+                                   taskh_t *peer, secure_bool_t *wake);
+
 /* per user/owner properties requests */
 
 kstatus_t mgr_mm_shm_is_mapped_by(shmh_t shm, shm_user_t accessor, secure_bool_t * result);
@@ -125,10 +165,29 @@ kstatus_t mgr_mm_shm_get_task_type(shmh_t shm, taskh_t task, shm_user_t *accesso
 
 kstatus_t mgr_mm_shm_is_writeable_by(shmh_t shm, shm_user_t accessor, secure_bool_t*result);
 
+kstatus_t mgr_mm_shm_check_access(shmh_t shm, taskh_t task, size_t offset, size_t len,
+                                  secure_bool_t write, size_t *base);
+
 kstatus_t mgr_mm_shm_configure(shmh_t shm, shm_user_t target, shm_config_t const *config);
 
 kstatus_t mgr_mm_shm_declare_user(shmh_t shm, taskh_t task);
 
+kstatus_t mgr_mm_shm_get_user(shmh_t shm, taskh_t *user);
+
+kstatus_t mgr_mm_shm_declare_reader(shmh_t shm, taskh_t task, shm_config_t const *config);
+
+kstatus_t mgr_mm_shm_remove_reader(shmh_t shm, taskh_t task);
+
+kstatus_t mgr_mm_shm_is_transferable(shmh_t shm, secure_bool_t *result);
+
+kstatus_t mgr_mm_shm_dma_alloc(shmh_t shm, taskh_t task, size_t len, size_t *offset);
+
+kstatus_t mgr_mm_shm_dma_free(shmh_t shm, taskh_t task, size_t offset);
+
+kstatus_t mgr_mm_shm_dma_release(shmh_t shm, taskh_t task);
+
+void mgr_mm_shm_dma_release_all(taskh_t task);
+
 /*
  * XXX:
  *  In order to restore task mpu config w/ fast loading, region configuration
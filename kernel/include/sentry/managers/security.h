@@ -24,6 +24,8 @@ kstatus_t mgr_security_init(void);
 
 kstatus_t mgr_security_entropy_generate(uint32_t *seed);
 
+kstatus_t mgr_security_entropy_fill(uint8_t *buf, size_t len);
+
 kstatus_t mgr_security_get_capa(taskh_t tsk, uint32_t *capas);
 
 secure_bool_t mgr_security_has_dev_capa(taskh_t tsk);
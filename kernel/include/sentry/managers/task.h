@@ -142,6 +142,32 @@ kstatus_t mgr_task_add_resource(taskh_t t, uint8_t resource_id, layout_resource_
  */
 kstatus_t mgr_task_remove_resource(taskh_t t, uint8_t resource_id);
 
+#if CONFIG_MM_REGION_CACHE
+/**
+ * @brief Add a mapped resource to the task overflow table, out of the task layout
+ *
+ * @param t task handle
+ * @param resource resource to add
+ */
+kstatus_t mgr_task_add_overflow_resource(taskh_t t, layout_resource_t resource);
+
+/**
+ * @brief Remove the resource starting at the given address from the task overflow table
+ *
+ * @param t task handle
+ * @param addr resource base address
+ */
+kstatus_t mgr_task_remove_overflow_resource(taskh_t t, uint32_t addr);
+
+/**
+ * @brief Load the overflow resource mapping the given address in the task layout
+ *
+ * @param t task handle
+ * @param addr faulting address
+ */
+kstatus_t mgr_task_refill_resource(taskh_t t, uint32_t addr);
+#endif
+
 
 kstatus_t mgr_task_get_layout_from_handle(taskh_t t, const layout_resource_t **layout);
 
@@ -191,6 +217,7 @@ kstatus_t mgr_task_load_dma_event(taskh_t target, dmah_t *dma_stream, gpdma_chan
 kstatus_t mgr_task_push_int_event(uint32_t IRQn, taskh_t dest);
 kstatus_t mgr_task_push_ipc_event(uint32_t len, taskh_t source, taskh_t dest);
 kstatus_t mgr_task_push_sig_event(uint32_t sig, taskh_t source, taskh_t dest);
+kstatus_t mgr_task_cancel_ipc_event(taskh_t source, taskh_t dest);
 
 kstatus_t mgr_task_load_ipc_event(taskh_t context);
 kstatus_t mgr_task_load_sig_event(taskh_t context, uint32_t *signal, taskh_t *source);
@@ -57,6 +57,29 @@ taskh_t sched_elect(void);
  */
 taskh_t sched_get_current(void);
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+/**
+ * @brief request a deferred election from an asynchronous handler
+ *
+ * The request is marked and PendSV is pended. Any election executed before
+ * PendSV (e.g. a blocking syscall) consumes the request.
+ */
+void sched_request_preempt(void);
+
+/**
+ * @brief elect the next job at PendSV time
+ *
+ * Contrary to sched_elect(), the current job, if still ready and not at the
+ * end of its timeslot, is only preempted: it keeps its position and its
+ * remaining timeslot, and is elected again once no higher priority job is
+ * eligible.
+ *
+ * @return the next job to execute, the current one if no election request
+ *  is pending
+ */
+taskh_t sched_preempt(void);
+#endif
+
 #if defined(CONFIG_SCHED_RRMQ)
 /**
  * @brief refresh RRMQ quantum of scheduler active task, may generate election
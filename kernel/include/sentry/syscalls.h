@@ -11,6 +11,8 @@
 
 stack_frame_t *gate_send_ipc(stack_frame_t *frame, taskh_t target, uint32_t len);
 
+stack_frame_t *gate_send_ipc_shm(stack_frame_t *frame, taskh_t target, uint32_t len, shmh_t shm);
+
 stack_frame_t *gate_waitforevent(stack_frame_t *frame, uint8_t mask, int32_t timeout);
 
 stack_frame_t *gate_send_signal(stack_frame_t *frame, taskh_t target, uint32_t signal);
@@ -83,4 +85,24 @@ stack_frame_t *gate_dma_suspend(stack_frame_t *frame, dmah_t dmah);
 
 stack_frame_t *gate_dma_resume(stack_frame_t *frame, dmah_t dmah);
 
+stack_frame_t *gate_get_kernel_stat(stack_frame_t *frame, uint32_t stat, uint32_t index);
+
+stack_frame_t *gate_trigger_irq_probe(stack_frame_t *frame, uint32_t ticks);
+
+stack_frame_t *gate_shm_cache_clean(stack_frame_t *frame, shmh_t shm, size_t offset, size_t len);
+
+stack_frame_t *gate_shm_cache_invalidate(stack_frame_t *frame, shmh_t shm, size_t offset, size_t len);
+
+stack_frame_t *gate_shm_ring_doorbell(stack_frame_t *frame, shmh_t shm, uint32_t event);
+
+stack_frame_t *gate_shm_dma_alloc(stack_frame_t *frame, shmh_t shm, size_t len);
+
+stack_frame_t *gate_shm_dma_free(stack_frame_t *frame, shmh_t shm, size_t offset);
+
+stack_frame_t *gate_shm_copy(stack_frame_t *frame);
+
+stack_frame_t *gate_get_random_buffer(stack_frame_t *frame, uint32_t len);
+
+stack_frame_t *gate_get_kinfo_page(stack_frame_t *frame);
+
 #endif/*!SYSCALLS_H*/
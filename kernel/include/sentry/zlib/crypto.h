@@ -32,6 +32,20 @@ uint32_t pcg32(void);
 
 /** @}*/
 
+/** \addtogroup CHACHA20
+ *  @{
+ */
+
+/*
+    requires \valid(out + (0 .. 15));
+    requires \valid_read(key + (0 .. 7));
+    requires \valid_read(nonce + (0 .. 2));
+    assigns out[0 .. 15];
+   */
+void chacha20_block(uint32_t out[16], uint32_t const key[8], uint32_t counter, uint32_t const nonce[3]);
+
+/** @}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -67,6 +67,11 @@ extern "C" {
  */
 #define ALIGN_TO_POW2(s) (1 << (32 - __builtin_clz (s - 1)))
 
+/**
+ * @brief Largest power of two lower or equal to `s`, `s` must not be 0
+ */
+#define FLOOR_POW2(s) (1UL << (31 - __builtin_clz (s)))
+
 
 #ifdef __cplusplus
 }
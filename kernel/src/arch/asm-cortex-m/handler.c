@@ -116,6 +116,9 @@ __STATIC_FORCEINLINE __attribute__((noreturn)) void hardfault_handler(stack_fram
     #endif
 #endif
     dump_frame(frame);
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+    mgr_debug_flush();
+#endif
     __platform_clear_flags();
     request_data_membarrier();
     __do_panic();
@@ -156,6 +159,17 @@ __STATIC_FORCEINLINE stack_frame_t *memfault_handler(stack_frame_t *frame)
 {
     stack_frame_t *newframe = frame;
     size_t cfsr = SCB->CFSR;
+#if CONFIG_MM_REGION_CACHE
+    const size_t miss = SCB_CFSR_DACCVIOL_Msk | SCB_CFSR_MMARVALID_Msk;
+    if ((is_userspace_fault(frame) == SECURE_TRUE) && ((cfsr & miss) == miss)) {
+        if (mgr_mm_region_cache_refill(sched_get_current(), SCB->MMFAR) == K_STATUS_OKAY) {
+            /* MPU region cache miss: the faulting access is replayed at handler exit */
+            SCB->CFSR = cfsr & SCB_CFSR_MEMFAULTSR_Msk;
+            request_data_membarrier();
+            goto end;
+        }
+    }
+#endif
     pr_err("Memory fault !!!");
     if (cfsr & SCB_CFSR_IACCVIOL_Msk) {
         pr_emerg("Instruction access violation!");
@@ -175,6 +189,9 @@ __STATIC_FORCEINLINE stack_frame_t *memfault_handler(stack_frame_t *frame)
     dump_frame(frame);
     newframe = may_panic(frame);
     request_data_membarrier();
+#if CONFIG_MM_REGION_CACHE
+end:
+#endif
     return newframe;
 }
 
@@ -205,6 +222,9 @@ stack_frame_t *svc_handler(stack_frame_t *frame)
     uint8_t syscall_id = 0;
     stack_frame_t *next_frame = frame;
     const lut_svc_handler *svc_lut;
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    uint32_t start;
+#endif
 
 #ifndef __FRAMAC__
     __GET_SVCNUM(frame->pc, syscall_id);
@@ -216,11 +236,52 @@ stack_frame_t *svc_handler(stack_frame_t *frame)
         goto err;
     }
     svc_lut = svc_lut_get();
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    start = dwt_cyccnt();
+    next_frame = (svc_lut[syscall_id])(frame);
+    mgr_debug_kstat_record(KERNEL_STAT_SYSCALL, syscall_id, dwt_cyccnt() - start);
+#else
     next_frame = (svc_lut[syscall_id])(frame);
+#endif
 err:
     return next_frame;
 }
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+/**
+ * @brief deferred context switching handler
+ *
+ * PendSV has the lowest priority and is tail-chained after any other pending
+ * handler. All reschedule requests emitted by asynchronous handlers since the
+ * last switch are collapsed into this single election, the current job being
+ * preempted, not rotated (see sched_preempt()).
+ */
+__STATIC_FORCEINLINE stack_frame_t *pendsv_handler(stack_frame_t *frame)
+{
+    stack_frame_t *newframe = frame;
+    taskh_t next;
+
+#if CONFIG_KERNEL_BASEPRI_MASKING
+    /*
+     * deliver critical interrupts received since the last switch. Owners wake-up
+     * may pend PendSV again while the election is executed right after, so the
+     * request is cleared before each flush, until no more interrupt is pending.
+     * A critical interrupt received after the last flush pends PendSV again.
+     */
+    do {
+        interrupt_clear_context_switch();
+    } while (mgr_interrupt_critical_flush() != 0UL);
+#endif
+    /* no-op if the request has been consumed by a synchronous election */
+    next = sched_preempt();
+
+    if (unlikely(mgr_task_get_sp(next, &newframe) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    return newframe;
+}
+#endif
+
 #define __GET_IPSR(intr) ({ \
     asm volatile ("mrs r1, ipsr\n\t" \
                   "mov %0, r1\n\t" \
@@ -245,6 +306,37 @@ end:
     return;
 }
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+/**
+ * asynchronous handler (systick, user interrupt) preempting another handler,
+ * i.e. returning to handler mode instead of thread mode
+ */
+__STATIC_FORCEINLINE secure_bool_t is_nested_async_exception(stack_frame_t *frame, int it)
+{
+    secure_bool_t res = SECURE_FALSE;
+    /* EXC_RETURN bit 3: (0) return to handler mode, (1) return to thread mode */
+    if (unlikely((frame->lr & 0x8UL) == 0UL) && ((it == SYSTICK_IRQ) || (it >= 0))) {
+        res = SECURE_TRUE;
+    }
+    return res;
+}
+
+/**
+ * nested asynchronous handler. These handlers never switch synchronously in
+ * deferred mode, the preempted handler frame is returned as is.
+ */
+__STATIC_FORCEINLINE stack_frame_t *nested_handler(stack_frame_t *frame, int it)
+{
+    stack_frame_t *newframe = frame;
+    if (it == SYSTICK_IRQ) {
+        newframe = systick_handler(frame);
+    } else {
+        newframe = userisr_handler(frame, it);
+    }
+    return newframe;
+}
+#endif
+
 /**
  * @brief dispatcher and generic handler manager
  *
@@ -259,7 +351,15 @@ stack_frame_t *Default_SubHandler(stack_frame_t *frame)
     taskh_t current = sched_get_current();
     taskh_t next;
     Status statuscode;
-
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    /*
+     * kernel masked window start, recorded in kernel statistics. The window
+     * is measured from the C handler entry to its return: the interrupts
+     * masking, context save and restore and MPU loading done in the
+     * assembly entry and exit sequences are not included.
+     */
+    uint32_t kstart = dwt_cyccnt();
+#endif
 
     /* get back interrupt name */
     __GET_IPSR(it);
@@ -275,6 +375,18 @@ stack_frame_t *Default_SubHandler(stack_frame_t *frame)
      */
     it-= 16;
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    /*
+     * PendSV, having the lowest priority, may be preempted by another kernel
+     * handler before its context is saved. In that case, the task context is
+     * not the one of the preempted handler: the task SP, memory mapping and
+     * syscall return are left to the PendSV handler.
+     */
+    if (unlikely(is_nested_async_exception(frame, it) == SECURE_TRUE)) {
+        newframe = nested_handler(frame, it);
+        goto end;
+    }
+#endif
     /* sync task ctx SP with current frame, always required */
     mgr_task_set_sp(current, (stack_frame_t*)__get_PSP());
 
@@ -294,15 +406,27 @@ stack_frame_t *Default_SubHandler(stack_frame_t *frame)
             demap_task_protected_area();
             newframe = svc_handler(frame);
             break;
+#if CONFIG_SCHED_DEFERRED_SWITCH
+        case PENDSV_IRQ:
+            demap_task_protected_area();
+            newframe = pendsv_handler(frame);
+            break;
+#endif
         case SYSTICK_IRQ:
             demap_task_protected_area();
             /* periodic, every each millisecond execution */
             newframe = systick_handler(frame);
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+            mgr_debug_kstat_record(KERNEL_STAT_SYSTICK, 0, dwt_cyccnt() - kstart);
+#endif
             break;
         default:
             demap_task_protected_area();
             if (it >= 0) {
                 newframe = userisr_handler(frame, it);
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+                mgr_debug_kstat_record(KERNEL_STAT_USER_IRQ, 0, dwt_cyccnt() - kstart);
+#endif
             }
             /* defaulting to nothing... */
             /* We might assert on spurious/unahndled exception here ? */
@@ -334,6 +458,12 @@ stack_frame_t *Default_SubHandler(stack_frame_t *frame)
         /* clearing the sysreturn. next job is no more syscall-preempted */
         mgr_task_clear_sysreturn(next);
     }
+#if CONFIG_SCHED_DEFERRED_SWITCH
+end:
+#endif
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    mgr_debug_kstat_record(KERNEL_STAT_MASKED_WINDOW, 0, dwt_cyccnt() - kstart);
+#endif
     return newframe;
 }
 
@@ -397,6 +527,11 @@ __attribute__((noreturn, used)) void Reset_Handler(void)
     shcsr = SCB_SHCSR_USGFAULTENA_Msk |
             SCB_SHCSR_MEMFAULTENA_Msk;
     iowrite32((size_t)&SCB->SHCSR, shcsr);
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    /* PendSV must be executed once all other handlers are terminated */
+    SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+    interrupt_set_priority(PENDSV_IRQ, INTERRUPT_LOWEST_PRIORITY);
+#endif
     /* branch to sentry kernel entry point */
     _entrypoint();
 
@@ -412,10 +547,23 @@ __attribute__((noreturn, used)) void Reset_Handler(void)
  *  privilege and FPU context at exception return.
  */
 
+#if CONFIG_KERNEL_BASEPRI_MASKING
+#define __HANDLER_STR(x) #x
+#define HANDLER_STR(x) __HANDLER_STR(x)
+/* mask kernel level and lower priority interrupts, critical ones stay enabled */
+#define KERNEL_MASK_IRQ     "mov     r1, #" HANDLER_STR(INTERRUPT_KERNEL_BASEPRI) "\r\n" \
+                            "msr     basepri, r1\r\n"
+#define KERNEL_UNMASK_IRQ   "mov     r1, #0\r\n" \
+                            "msr     basepri, r1\r\n"
+#else
+#define KERNEL_MASK_IRQ     "cpsid   i\r\n"         /* Disable all interrupts */
+#define KERNEL_UNMASK_IRQ
+#endif
+
 __STATIC_FORCEINLINE void save_context(void)
 {
     asm volatile (
-    "cpsid   i\r\n"         /* Disable all interrupts */
+    KERNEL_MASK_IRQ
     "dsb \r\n"
     "isb \r\n"
     "tst     lr, #4\r\n"    /* bit 2: (0) MSP (1) PSP stack */
@@ -440,6 +588,7 @@ __STATIC_FORCEINLINE void restore_context(void)
     "msreq   msp, r0\r\n"   /* MSP <- r0 */
     "msrne   psp, r0\r\n"   /* PSP <- r0 */
     "isb\r\n"
+    KERNEL_UNMASK_IRQ
     "cpsie   i\r\n"
     "dsb \r\n"
     "isb \r\n"
@@ -456,6 +605,22 @@ __STATIC_FORCEINLINE void restore_context(void)
  */
 __attribute__((naked, used)) void Default_Handler(void)
 {
+#if CONFIG_KERNEL_BASEPRI_MASKING
+    /*
+     * critical interrupts kernel bypass, before any context save. Only caller-saved
+     * registers are used, which are already stacked by the hardware.
+     */
+    asm volatile (
+        "mrs     r0, ipsr\r\n"
+        "push    {r0, lr}\r\n"
+        "bl      critisr_handler\r\n"
+        "pop     {r1, lr}\r\n"
+        "cmp     r0, #0\r\n"
+        "it      ne\r\n"
+        "bxne    lr\r\n"
+        ::: "memory"
+    );
+#endif
     save_context();
     asm volatile (
         "bl Default_SubHandler" ::: "memory"
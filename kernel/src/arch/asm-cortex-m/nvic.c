@@ -253,6 +253,30 @@ uint32_t nvic_get_active(uint32_t IRQn)
               (uint32_t) (1UL << ((uint32_t) (IRQn) & 0x1F))) ? 1 : 0));
 }
 
+/* \brief  Set Interrupt Priority
+ * This function sets the priority of an interrupt, including the configurable
+ * core exceptions (negative IRQn, from MemManage up to SysTick).
+ * Lower value means higher priority.
+ * \param [in]      IRQn  Number of the interrupt or exception
+ * \param [in]  priority  priority to set, in [0..(2^__NVIC_PRIO_BITS)-1]
+ */
+kstatus_t nvic_set_priority(int32_t IRQn, uint32_t priority)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    if (unlikely((IRQn < MEMMANAGE_IRQ) || (IRQn >= (int32_t)NUM_IRQS))) {
+        goto end;
+    }
+    if (unlikely(priority > INTERRUPT_LOWEST_PRIORITY)) {
+        goto end;
+    }
+    NVIC_SetPriority((IRQn_Type)IRQn, priority);
+    arch_data_sync_barrier();
+    arch_inst_sync_barrier();
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
 /* \brief  System Reset
  * This function initiate a system reset request to reset the MCU.
  */
@@ -273,6 +297,7 @@ uint32_t interrupt_get_pending_irq(uint32_t IRQn) __attribute__((alias("nvic_get
 kstatus_t     interrupt_set_pending_irq(uint32_t IRQn) __attribute__((alias("nvic_set_pendingirq")));
 kstatus_t     interrupt_clear_pendingirq(uint32_t IRQn) __attribute__((alias("nvic_clear_pendingirq")));
 uint32_t interrupt_get_active(uint32_t IRQn) __attribute__((alias("nvic_get_active")));
+kstatus_t     interrupt_set_priority(int32_t IRQn, uint32_t priority) __attribute__((alias("nvic_set_priority")));
 void     interrupt_systemreset(void) __attribute__((alias("nvic_systemreset")));
 void     interrupt_set_prioritygrouping(uint32_t PriorityGroup) __attribute__((alias("nvic_set_prioritygrouping")));
 uint32_t interrupt_get_prioritygrouping(void) __attribute__((alias("nvig_get_prioritygrouping")));
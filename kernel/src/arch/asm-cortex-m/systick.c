@@ -35,6 +35,37 @@ stack_frame_t *sched_refresh(stack_frame_t *frame);
  */
 void mgr_time_delay_tick(void);
 
+#if CONFIG_DEBUG_IRQ_PROBE
+/*@
+  // TODO: by do, no border effect as managers not yet proven
+  assigns \nothing;
+ */
+void mgr_debug_irqprobe_tick(void);
+#endif
+
+#if CONFIG_DEBUG_BINARY_LOG
+/*@
+  // TODO: by do, no border effect as managers not yet proven
+  assigns \nothing;
+ */
+void mgr_debug_binlog_tick(void);
+#endif
+
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+/*@
+  // TODO: by do, no border effect as managers not yet proven
+  assigns \nothing;
+ */
+void mgr_debug_userlog_tick(void);
+#endif
+
+#if CONFIG_MM_KINFO_PAGE
+/*@
+  // TODO: by do, no border effect as managers not yet proven
+  assigns \nothing;
+ */
+void mgr_mm_kinfo_tick(uint64_t jiffies, uint64_t cycles);
+#endif
 
 
 // FIXME: systick registers defs is in cmsis (core.h)
@@ -164,12 +195,29 @@ stack_frame_t *systick_handler(stack_frame_t * stack_frame)
      * This is done with HZ period, which guarantee that the no DWT loop is
      * missed, except in low power mode (when systick is deactivated).
      */
+#if CONFIG_MM_KINFO_PAGE
+    /* and publish it in the kernel information page */
+    mgr_mm_kinfo_tick(jiffies, systime_get_cycle());
+#else
     systime_get_cycle();
+#endif
 #if CONFIG_SCHED_RRMQ
     /* refresh quantums */
     stack_frame = sched_refresh(stack_frame);
 #endif
     /* upgrade delayed tasks (slepping task) */
     mgr_time_delay_tick();
+#if CONFIG_DEBUG_IRQ_PROBE
+    /* latency probe delayed trigger */
+    mgr_debug_irqprobe_tick();
+#endif
+#if CONFIG_DEBUG_BINARY_LOG
+    /* bounded kernel binary logs emission */
+    mgr_debug_binlog_tick();
+#endif
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+    /* bounded userspace logs emission */
+    mgr_debug_userlog_tick();
+#endif
     return stack_frame;
 }
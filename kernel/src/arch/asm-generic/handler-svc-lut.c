@@ -4,6 +4,7 @@
 #include <sentry/arch/asm-generic/thread.h>
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
+#include <sentry/managers/debug.h>
 #include <sentry/sched.h>
 
 #include <sentry/arch/asm-generic/handler-svc-lut.h>
@@ -214,6 +215,69 @@ static stack_frame_t *lut_dma_stream_resume(stack_frame_t *frame) {
     return gate_dma_resume(frame, dma);
 }
 
+static stack_frame_t *lut_get_kernel_stat(stack_frame_t *frame) {
+    uint32_t stat = frame->r0;
+    uint32_t index = frame->r1;
+    return gate_get_kernel_stat(frame, stat, index);
+}
+
+static stack_frame_t *lut_trigger_irq_probe(stack_frame_t *frame) {
+    uint32_t ticks = frame->r0;
+    return gate_trigger_irq_probe(frame, ticks);
+}
+
+static stack_frame_t *lut_shm_cache_clean(stack_frame_t *frame) {
+    shmh_t shm = frame->r0;
+    size_t offset = frame->r1;
+    size_t len = frame->r2;
+    return gate_shm_cache_clean(frame, shm, offset, len);
+}
+
+static stack_frame_t *lut_shm_cache_invalidate(stack_frame_t *frame) {
+    shmh_t shm = frame->r0;
+    size_t offset = frame->r1;
+    size_t len = frame->r2;
+    return gate_shm_cache_invalidate(frame, shm, offset, len);
+}
+
+static stack_frame_t *lut_shm_ring_doorbell(stack_frame_t *frame) {
+    shmh_t shm = frame->r0;
+    uint32_t event = frame->r1;
+    return gate_shm_ring_doorbell(frame, shm, event);
+}
+
+static stack_frame_t *lut_send_ipc_shm(stack_frame_t *frame) {
+    taskh_t target = frame->r0;
+    uint32_t len = frame->r1;
+    shmh_t shm = frame->r2;
+    return gate_send_ipc_shm(frame, target, len, shm);
+}
+
+static stack_frame_t *lut_shm_dma_alloc(stack_frame_t *frame) {
+    shmh_t shm = frame->r0;
+    size_t len = frame->r1;
+    return gate_shm_dma_alloc(frame, shm, len);
+}
+
+static stack_frame_t *lut_shm_dma_free(stack_frame_t *frame) {
+    shmh_t shm = frame->r0;
+    size_t offset = frame->r1;
+    return gate_shm_dma_free(frame, shm, offset);
+}
+
+static stack_frame_t *lut_shm_copy(stack_frame_t *frame) {
+    return gate_shm_copy(frame);
+}
+
+static stack_frame_t *lut_get_random_buffer(stack_frame_t *frame) {
+    uint32_t len = frame->r0;
+    return gate_get_random_buffer(frame, len);
+}
+
+static stack_frame_t *lut_get_kinfo_page(stack_frame_t *frame) {
+    return gate_get_kinfo_page(frame);
+}
+
 /* for not yet supported syscalls */
 static stack_frame_t *lut_unsuported(stack_frame_t *frame) {
     mgr_task_set_sysreturn(sched_get_current(), STATUS_NO_ENTITY);
@@ -259,10 +323,25 @@ static const lut_svc_handler svc_lut[] = {
     lut_dma_unassign,
     lut_dma_get_stream_info,
     lut_dma_stream_resume,
+    lut_get_kernel_stat,
+    lut_trigger_irq_probe,
+    lut_shm_cache_clean,
+    lut_shm_cache_invalidate,
+    lut_shm_ring_doorbell,
+    lut_send_ipc_shm,
+    lut_shm_dma_alloc,
+    lut_shm_dma_free,
+    lut_shm_copy,
+    lut_get_random_buffer,
+    lut_get_kinfo_page,
 };
 
 #define SYSCALL_NUM ARRAY_SIZE(svc_lut)
 
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+static_assert(SYSCALL_NUM <= KSTAT_SYSCALL_NUM, "per-syscall statistics table too small");
+#endif
+
 lut_svc_handler const *svc_lut_get(void) {
     return &svc_lut[0];
 }
@@ -42,4 +42,8 @@ void panic_print_event(panic_event_t ev) {
     }
     pr_debug("panic event: PANIC_%s", panic_events_name[ev]);
 #endif
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+    /* pending logs will not be emitted anymore otherwise */
+    mgr_debug_flush();
+#endif
 }
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * \file STM32 CRC calculation unit driver, used as CRC32 backend of the
+ * kernel zlib (see ST RM0456, CRC chapter)
+ */
+#include <stdbool.h>
+
+#include <sentry/arch/asm-cortex-m/soc.h>
+#include <sentry/arch/asm-cortex-m/layout.h>
+#include <sentry/io.h>
+#include <sentry/bits.h>
+#include <sentry/ktypes.h>
+#include <sentry/managers/memory.h>
+#include <bsp/drivers/clk/rcc.h>
+#include <bsp/drivers/crc/crc.h>
+#include "crc_defs.h"
+#include "stm32-crc-dt.h"
+
+/* reset value of the CRC_POL register, i.e. the CRC32 polynomial */
+#define CRC32_POLYNOMIAL 0x04c11db7UL
+
+static bool crc_enabled;
+
+static inline kstatus_t crc_map(void)
+{
+    stm32_crc_desc_t const * desc = stm32_crc_get_desc();
+    return mgr_mm_map_kdev(desc->base_addr, desc->size);
+}
+
+static inline kstatus_t crc_unmap(void) {
+    return mgr_mm_unmap_kdev();
+}
+
+/**
+ * @brief 32 bits bit-reversal
+ */
+static inline uint32_t crc_rbit(uint32_t v)
+{
+    v = ((v >> 1) & 0x55555555UL) | ((v & 0x55555555UL) << 1);
+    v = ((v >> 2) & 0x33333333UL) | ((v & 0x33333333UL) << 2);
+    v = ((v >> 4) & 0x0f0f0f0fUL) | ((v & 0x0f0f0f0fUL) << 4);
+    return __builtin_bswap32(v);
+}
+
+/**
+ * @brief probe the CRC calculation unit
+ *
+ * The unit is configured for the zlib crc32() algorithm: 32 bits polynomial,
+ * input bytes and output word bit-reversed, no final xor.
+ *
+ * @return K_ERROR_NOENT if the CRC IP is not enabled in the DTS,
+ *   K_ERROR_BADSTATE if already probed, K_STATUS_OKAY otherwise
+ */
+kstatus_t crc_probe(void)
+{
+    kstatus_t status = K_ERROR_BADSTATE;
+    stm32_crc_desc_t const * desc = stm32_crc_get_desc();
+    uint32_t reg;
+
+    /* BSS is zeroified at boot, should be false at startup */
+    if (unlikely(crc_enabled)) {
+        goto err;
+    }
+    if (unlikely(desc->base_addr == 0)) {
+        status = K_ERROR_NOENT;
+        goto err;
+    }
+    if (unlikely((status = rcc_enable(desc->bus_id, desc->clk_msk, RCC_NOFLAG)) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    if (unlikely((status = crc_map()) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    iowrite32(desc->base_addr + CRC_POL_REG, CRC32_POLYNOMIAL);
+    /* 32 bits polynomial (POLYSIZE = 0), bit-reversal by byte on input */
+    reg = (0x1UL << CRC_CR_REV_IN_SHIFT) | CRC_CR_REV_OUT;
+    iowrite32(desc->base_addr + CRC_CR_REG, reg);
+    crc_unmap();
+    crc_enabled = true;
+err:
+    return status;
+}
+
+/**
+ * @brief compute the zlib crc32() of the given buffer with the CRC unit
+ *
+ * The CRC unit works on the non-reflected domain, so that the initial value
+ * is bit-reversed. Words are written byte-swapped, as the unit consumes the
+ * data register from its most significant byte. Unaligned head and tail are
+ * written as bytes.
+ *
+ * The CRC unit is mapped as kernel device during the computation, the caller
+ * must not hold any other kernel device mapping.
+ *
+ * @return K_ERROR_NOTREADY if the unit is not probed, K_STATUS_OKAY otherwise
+ */
+kstatus_t crc_hw_compute(uint8_t const * buf, uint32_t len, uint32_t init, uint32_t *crc)
+{
+    kstatus_t status = K_ERROR_NOTREADY;
+    stm32_crc_desc_t const * desc = stm32_crc_get_desc();
+    size_t dr = desc->base_addr + CRC_DR_REG;
+    uint32_t i = 0;
+
+    if (unlikely(!crc_enabled)) {
+        goto err;
+    }
+    if (unlikely((status = crc_map()) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    iowrite32(desc->base_addr + CRC_INIT_REG, crc_rbit(init));
+    /* load INIT into the data register */
+    iowrite32(desc->base_addr + CRC_CR_REG,
+              ioread32(desc->base_addr + CRC_CR_REG) | CRC_CR_RESET);
+    while ((i < len) && ((((size_t)&buf[i]) & 0x3UL) != 0)) {
+        iowrite8(dr, buf[i]);
+        i++;
+    }
+    while ((len - i) >= 4) {
+        iowrite32(dr, __builtin_bswap32(*(uint32_t const *)&buf[i]));
+        i += 4;
+    }
+    while (i < len) {
+        iowrite8(dr, buf[i]);
+        i++;
+    }
+    *crc = ioread32(dr);
+    crc_unmap();
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
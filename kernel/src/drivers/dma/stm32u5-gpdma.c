@@ -37,6 +37,21 @@
 #define GPDMA_CxTR3(x)  (0xa4+(0x80 * x))
 #define GPDMA_CxBR2(x)  (0xa8+(0x80 * x))
 
+/* linked-list register update flags and address masks */
+#define GPDMA_CxLLR_UB1     (1UL << 29)
+#define GPDMA_CxLLR_USA     (1UL << 28)
+#define GPDMA_CxLLR_UDA     (1UL << 27)
+#define GPDMA_CxLLR_ULL     (1UL << 16)
+#define GPDMA_CxLLR_LA_MASK 0xfffcUL
+#define GPDMA_CxLBAR_MASK   0xffff0000UL
+
+/*
+ * linked-list item, made of the registers updated at each block end, in the
+ * order of the hardware LLI layout (BR1, SAR, DAR, LLR)
+ */
+#define GPDMA_LLI_WORDS     4UL
+#define GPDMA_LLI_FLAGS     (GPDMA_CxLLR_UB1 | GPDMA_CxLLR_USA | GPDMA_CxLLR_UDA | GPDMA_CxLLR_ULL)
+
 /**
  * @brief register typing helper union
  *
@@ -169,7 +184,8 @@ kstatus_t stm32u5_gpdma_probe(uint8_t controller)
      * When using secure mode, the secure configuration register must be set accordingly
      */
     /*
-     * force channels to be unprivileged, as Sentry kernel do not use DMA chans for its own.
+     * force channels to be unprivileged, as Sentry kernel do not use DMA chans for its own,
+     * except its optional memory copy channel (see gpdma_channel_set_privileged()).
      * such a configuration avoid any userspace-to-kernelspace corruption, but do not permit
      * userspace-to-userspace corruption prevention.
      * as a consequence, all device and memory ranges accedded need to be checked at configure
@@ -179,6 +195,13 @@ kstatus_t stm32u5_gpdma_probe(uint8_t controller)
         goto end;
     }
     reg.raw = 0;
+#if CONFIG_DMA_KERNEL_MEMCPY
+    /* the kernel memory copy channel, set privileged at boot, keeps its privilege */
+    if (controller == 0) {
+        reg.raw = ioread32(ctrl_desc->base_addr + GPDMA_PRIVCFGR_REG) &
+                  (0x1UL << CONFIG_DMA_KERNEL_MEMCPY_CHANNEL);
+    }
+#endif
     iowrite32(ctrl_desc->base_addr + GPDMA_PRIVCFGR_REG, reg.raw);
     gpdma_unmap();
     /**
@@ -222,26 +245,13 @@ end:
 }
 
 
-kstatus_t smt32u5_gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc, gpdma_chan_status_t * statusf)
+/* decode the channel status register, the controller being mapped */
+static void stm32u5_gpdma_channel_read_status(stm32_gpdma_desc_t const * ctrl_desc, uint8_t channel,
+                                              gpdma_chan_status_t * statusf)
 {
-    kstatus_t status = K_ERROR_INVPARAM;
-    stm32_gpdma_desc_t const * ctrl_desc;
     gpdma_register_t cxsr;
 
-    if (unlikely(desc == NULL) || statusf == NULL) {
-        goto end;
-    }
-    ctrl_desc = stm32_gpdma_get_desc(desc->controller);
-    if (unlikely(ctrl_desc == NULL)) {
-        goto end;
-    }
-    if (unlikely(desc->channel >= ctrl_desc->num_chan)) {
-        goto end;
-    }
-    if (unlikely(gpdma_map(desc->controller) != K_STATUS_OKAY)) {
-        goto end;
-    }
-    cxsr.raw = ioread32(ctrl_desc->base_addr + GPDMA_CxFCR(desc->channel));
+    cxsr.raw = ioread32(ctrl_desc->base_addr + GPDMA_CxSR(channel));
     statusf->half_reached = !!cxsr.cxsr.htf;
     statusf->completed = !!cxsr.cxsr.tcf;
     if (!!cxsr.cxsr.idlef) {
@@ -262,12 +272,68 @@ kstatus_t smt32u5_gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc,
         statusf->state = GPDMA_STATE_OVERRUN;
     }
 #endif
+}
+
+kstatus_t smt32u5_gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc, gpdma_chan_status_t * statusf)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    stm32_gpdma_desc_t const * ctrl_desc;
+
+    if (unlikely(desc == NULL) || statusf == NULL) {
+        goto end;
+    }
+    ctrl_desc = stm32_gpdma_get_desc(desc->controller);
+    if (unlikely(ctrl_desc == NULL)) {
+        goto end;
+    }
+    if (unlikely(desc->channel >= ctrl_desc->num_chan)) {
+        goto end;
+    }
+    if (unlikely(gpdma_map(desc->controller) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    stm32u5_gpdma_channel_read_status(ctrl_desc, desc->channel, statusf);
     gpdma_unmap();
     status = K_STATUS_OKAY;
 end:
     return status;
 }
 
+kstatus_t stm32u5_gpdma_channel_poll(gpdma_stream_cfg_t const*const desc, gpdma_chan_state_t state,
+                                     uint32_t max_polls, gpdma_chan_status_t * statusf)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    stm32_gpdma_desc_t const * ctrl_desc;
+
+    if (unlikely(desc == NULL) || statusf == NULL) {
+        goto end;
+    }
+    ctrl_desc = stm32_gpdma_get_desc(desc->controller);
+    if (unlikely(ctrl_desc == NULL)) {
+        goto end;
+    }
+    if (unlikely(desc->channel >= ctrl_desc->num_chan)) {
+        goto end;
+    }
+    if (unlikely(gpdma_map(desc->controller) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    status = K_ERROR_BUSY;
+    for (uint32_t poll = 0; poll < max_polls; ++poll) {
+        stm32u5_gpdma_channel_read_status(ctrl_desc, desc->channel, statusf);
+        if ((statusf->completed != 0) ||
+            (statusf->state == state) ||
+            (statusf->state == GPDMA_STATE_TRANSMISSION_FAILURE) ||
+            (statusf->state == GPDMA_STATE_CONFIGURATION_FAILURE)) {
+            status = K_STATUS_OKAY;
+            break;
+        }
+    }
+    gpdma_unmap();
+end:
+    return status;
+}
+
 kstatus_t stm32u5_gpdma_channel_configure(gpdma_stream_cfg_t const*const desc)
 {
     kstatus_t status = K_ERROR_INVPARAM;
@@ -299,13 +365,13 @@ kstatus_t stm32u5_gpdma_channel_configure(gpdma_stream_cfg_t const*const desc)
     }
     /* configure channel-local infos */
     reg.raw = ioread32(ctrl_desc->base_addr + GPDMA_CxCR(desc->channel));
-    if (desc->interrupts | GPDMA_INT_TC) {
+    if (desc->interrupts & GPDMA_INT_TC) {
         reg.cxcr.tcie = 1;
     }
-    if (desc->interrupts | GPDMA_INT_HT) {
+    if (desc->interrupts & GPDMA_INT_HT) {
         reg.cxcr.htie = 1;
     }
-    if (desc->interrupts | GPDMA_INT_ERROR) {
+    if (desc->interrupts & GPDMA_INT_ERROR) {
         reg.cxcr.uleie = 1;
         reg.cxcr.dteie = 1;
     }
@@ -350,10 +416,10 @@ kstatus_t stm32u5_gpdma_channel_configure(gpdma_stream_cfg_t const*const desc)
             reg.cxtr1.sinc = 0;
             reg.cxtr1.dinc = 0;
     }
-    if (desc->transfer_mode | GPDMA_TRANSFER_MODE_INCREMENT_SRC) {
+    if (desc->transfer_mode & GPDMA_TRANSFER_MODE_INCREMENT_SRC) {
         reg.cxtr1.sinc = 1;
     }
-    if (desc->transfer_mode | GPDMA_TRANSFER_MODE_INCREMENT_DEST) {
+    if (desc->transfer_mode & GPDMA_TRANSFER_MODE_INCREMENT_DEST) {
         reg.cxtr1.dinc = 1;
     }
     iowrite32(ctrl_desc->base_addr + GPDMA_CxTR1(desc->channel), reg.raw);
@@ -422,7 +488,136 @@ kstatus_t stm32u5_gpdma_channel_configure(gpdma_stream_cfg_t const*const desc)
     reg.raw = 0;
     reg.cxdar.da = desc->dest;
     iowrite32(ctrl_desc->base_addr + GPDMA_CxDAR(desc->channel), reg.raw);
+    /* single block by default, a previous linked-list stream may have set the link */
+    iowrite32(ctrl_desc->base_addr + GPDMA_CxLLR(desc->channel), 0UL);
+
+    gpdma_unmap();
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @fn build the linked-list table of a configured channel and link the channel to it
+ *
+ * The first block is the one programmed by stm32u5_gpdma_channel_configure().
+ * In circular mode, a single LLI reloads the very same block and links to
+ * itself. In double-buffer mode, two LLIs alternatively reload the second and
+ * the first memory buffer, the second buffer following the first one. As the
+ * table is loaded by the hardware at each block end, no software restart is
+ * needed and the transfer complete event is emitted at each block end.
+ */
+kstatus_t stm32u5_gpdma_channel_link(gpdma_stream_cfg_t const*const desc, size_t lli)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    stm32_gpdma_desc_t const * ctrl_desc;
+    gpdma_register_t reg;
+    volatile uint32_t *table = (volatile uint32_t *)lli;
+    size_t br1;
+    size_t sar;
+    size_t dar;
 
+    if (unlikely(desc == NULL)) {
+        goto end;
+    }
+    /* LLIs are word aligned and all in the same 64k page, pointed by LBAR */
+    if (unlikely((lli & 0x3UL) != 0) ||
+        unlikely((lli & GPDMA_CxLBAR_MASK) != ((lli + GPDMA_LLI_TABLE_MAX_LEN - 1UL) & GPDMA_CxLBAR_MASK))) {
+        goto end;
+    }
+    ctrl_desc = stm32_gpdma_get_desc(desc->controller);
+    if (unlikely(ctrl_desc == NULL)) {
+        goto end;
+    }
+    if (unlikely(desc->channel >= ctrl_desc->num_chan)) {
+        goto end;
+    }
+    if (unlikely(gpdma_map(desc->controller) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (unlikely(!smt32u5_gpdma_is_channel_idle(desc->controller, desc->channel))) {
+        status = K_ERROR_BADSTATE;
+        goto unmap;
+    }
+    /* channel registers hold the first block configuration, reloaded by LLIs */
+    br1 = ioread32(ctrl_desc->base_addr + GPDMA_CxBR1(desc->channel));
+    sar = ioread32(ctrl_desc->base_addr + GPDMA_CxSAR(desc->channel));
+    dar = ioread32(ctrl_desc->base_addr + GPDMA_CxDAR(desc->channel));
+    switch (desc->linked_list) {
+        case GPDMA_LINKED_LIST_CIRCULAR:
+            table[0] = br1;
+            table[1] = sar;
+            table[2] = dar;
+            table[3] = GPDMA_LLI_FLAGS | (lli & GPDMA_CxLLR_LA_MASK);
+            break;
+        case GPDMA_LINKED_LIST_DOUBLE_BUFFER: {
+            size_t lli_b = lli + (GPDMA_LLI_WORDS * sizeof(uint32_t));
+            size_t sar_b = sar;
+            size_t dar_b = dar;
+            /* only the memory side(s) of the stream switch to the second buffer */
+            if ((desc->transfer_type == GPDMA_TRANSFER_MEMORY_TO_DEVICE) ||
+                (desc->transfer_type == GPDMA_TRANSFER_MEMORY_TO_MEMORY)) {
+                sar_b += desc->transfer_len;
+            }
+            if ((desc->transfer_type == GPDMA_TRANSFER_DEVICE_TO_MEMORY) ||
+                (desc->transfer_type == GPDMA_TRANSFER_MEMORY_TO_MEMORY)) {
+                dar_b += desc->transfer_len;
+            }
+            /* loaded at first buffer end */
+            table[0] = br1;
+            table[1] = sar_b;
+            table[2] = dar_b;
+            table[3] = GPDMA_LLI_FLAGS | (lli_b & GPDMA_CxLLR_LA_MASK);
+            /* loaded at second buffer end */
+            table[4] = br1;
+            table[5] = sar;
+            table[6] = dar;
+            table[7] = GPDMA_LLI_FLAGS | (lli & GPDMA_CxLLR_LA_MASK);
+            break;
+        }
+        default:
+            goto unmap;
+    }
+    iowrite32(ctrl_desc->base_addr + GPDMA_CxLBAR(desc->channel), lli & GPDMA_CxLBAR_MASK);
+    iowrite32(ctrl_desc->base_addr + GPDMA_CxLLR(desc->channel),
+              GPDMA_LLI_FLAGS | (lli & GPDMA_CxLLR_LA_MASK));
+    /* the list never ends: transfer complete event at each block end */
+    reg.raw = ioread32(ctrl_desc->base_addr + GPDMA_CxTR2(desc->channel));
+    reg.cxtr2.tcem = 0;
+    iowrite32(ctrl_desc->base_addr + GPDMA_CxTR2(desc->channel), reg.raw);
+    /* execute the full list, not one LLI at a time */
+    reg.raw = ioread32(ctrl_desc->base_addr + GPDMA_CxCR(desc->channel));
+    reg.cxcr.lsm = 0;
+    iowrite32(ctrl_desc->base_addr + GPDMA_CxCR(desc->channel), reg.raw);
+    status = K_STATUS_OKAY;
+unmap:
+    gpdma_unmap();
+end:
+    return status;
+}
+
+kstatus_t stm32u5_gpdma_channel_set_privileged(gpdma_stream_cfg_t const*const desc)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    stm32_gpdma_desc_t const * ctrl_desc;
+    uint32_t privcfgr;
+
+    if (unlikely(desc == NULL)) {
+        goto end;
+    }
+    ctrl_desc = stm32_gpdma_get_desc(desc->controller);
+    if (unlikely(ctrl_desc == NULL)) {
+        goto end;
+    }
+    if (unlikely(desc->channel >= ctrl_desc->num_chan)) {
+        goto end;
+    }
+    if (unlikely(gpdma_map(desc->controller) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    privcfgr = ioread32(ctrl_desc->base_addr + GPDMA_PRIVCFGR_REG);
+    privcfgr |= (0x1UL << desc->channel);
+    iowrite32(ctrl_desc->base_addr + GPDMA_PRIVCFGR_REG, privcfgr);
     gpdma_unmap();
     status = K_STATUS_OKAY;
 end:
@@ -580,7 +775,10 @@ kstatus_t stm32u5_gpdma_channel_restart(void)
 kstatus_t gpdma_probe(uint8_t controller) __attribute((alias("stm32u5_gpdma_probe")));
 kstatus_t gpdma_channel_clear_status(gpdma_stream_cfg_t const*const desc) __attribute__((alias("smt32u5_gpdma_channel_clear_status")));
 kstatus_t gpdma_channel_get_status(gpdma_stream_cfg_t const*const desc, gpdma_chan_status_t * status) __attribute__((alias("smt32u5_gpdma_channel_get_status")));
+kstatus_t gpdma_channel_poll(gpdma_stream_cfg_t const*const desc, gpdma_chan_state_t state, uint32_t max_polls, gpdma_chan_status_t * status) __attribute__((alias("stm32u5_gpdma_channel_poll")));
 kstatus_t gpdma_channel_configure(gpdma_stream_cfg_t const*const desc) __attribute__((alias("stm32u5_gpdma_channel_configure")));
+kstatus_t gpdma_channel_link(gpdma_stream_cfg_t const*const desc, size_t lli) __attribute__((alias("stm32u5_gpdma_channel_link")));
+kstatus_t gpdma_channel_set_privileged(gpdma_stream_cfg_t const*const desc) __attribute__((alias("stm32u5_gpdma_channel_set_privileged")));
 kstatus_t gpdma_channel_enable(gpdma_stream_cfg_t const*const desc) __attribute__((alias("stm32u5_gpdma_channel_enable")));
 kstatus_t gpdma_channel_suspend(gpdma_stream_cfg_t const*const desc) __attribute__((alias("stm32u5_gpdma_channel_suspend")));
 kstatus_t gpdma_channel_resume(gpdma_stream_cfg_t const*const desc) __attribute__((alias("stm32u5_gpdma_channel_resume")));
@@ -278,16 +278,16 @@ kstatus_t exti_generate_swinterrupt(uint8_t itn)
         if (unlikely((reg & (0X1UL << itn)) == 0)) {
             /* interrupt is masked */
             status = K_ERROR_BADSTATE;
-            goto err;
+            goto end;
         }
         reg = ioread32(EXTI_BASE_ADDR + EXTI_SWIER_REG);
         if (unlikely((reg & (0X1UL << itn)))) {
             /* bit already set */
             status = K_ERROR_BADSTATE;
-            goto err;
+            goto end;
         }
         reg |= (1UL << itn);
-        iowrite32(EXTI_BASE_ADDR + EXTI_EMR_REG, reg);
+        iowrite32(EXTI_BASE_ADDR + EXTI_SWIER_REG, reg);
     }
 #if defined(CONFIG_SOC_SUBFAMILY_STM32L4)
     else {
@@ -295,23 +295,60 @@ kstatus_t exti_generate_swinterrupt(uint8_t itn)
         if (unlikely((reg & (0X1UL << (itn % 32))) == 0)) {
             /* interrupt is masked */
             status = K_ERROR_BADSTATE;
-            goto err;
+            goto end;
         }
         reg = ioread32(EXTI_BASE_ADDR + EXTI_SWIER2_REG);
         if (unlikely((reg & (0X1UL << (itn % 32))))) {
             /* bit already set */
             status = K_ERROR_BADSTATE;
-            goto err;
+            goto end;
         }
         reg |= (1UL << (itn % 32));
-        iowrite32(EXTI_BASE_ADDR + EXTI_EMR2_REG, reg);
+        iowrite32(EXTI_BASE_ADDR + EXTI_SWIER2_REG, reg);
     }
 #endif
+end:
     exti_unmap();
 err:
     return status;
 }
 
+/**
+ * @brief get back the NVIC interrupt line associated to itn
+ *
+ * The DTS interrupts list is ordered by EXTI line. This is only valid for
+ * EXTI lines that have a dedicated NVIC interrupt (lines 0 to 4 on all the
+ * supported SoCs), as the upper lines share their NVIC interrupt.
+ *
+ * @return K_ERROR_INVPARAM if itn is not a valid EXTI line, K_ERROR_NOENT if
+ *  the EXTI node has no interrupts (disabled in the DTS), K_STATUS_OKAY
+ *  otherwise
+ */
+/*@
+  requires \valid(irqn);
+  assigns *irqn;
+  ensures itn >= EXTI_NUM_INTERRUPTS ==> \result == K_ERROR_INVPARAM;
+  ensures \result == K_STATUS_OKAY ==> itn < EXTI_NUM_INTERRUPTS;
+ */
+kstatus_t exti_get_irqn(uint8_t itn, uint32_t *irqn)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    stm32_exti_desc_t const * desc = stm32_exti_get_desc();
+
+    if (unlikely(itn >= EXTI_NUM_INTERRUPTS)) {
+        goto err;
+    }
+    if (unlikely(desc->irqs == NULL)) {
+        /* EXTI node disabled, no interrupt list generated */
+        status = K_ERROR_NOENT;
+        goto err;
+    }
+    *irqn = desc->irqs[itn];
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
 /**
  * @brief Clear pending interrupt flag for itn
  */
@@ -16,6 +16,9 @@
 #include <sentry/zlib/crypto.h>
 #include <sentry/managers/memory.h>
 #include <bsp/drivers/clk/rcc.h>
+#if CONFIG_CRC32_HW_STM32
+#include <bsp/drivers/crc/crc.h>
+#endif
 #include "rng_defs.h"
 #include "stm32-rng-dt.h"
 
@@ -23,6 +26,10 @@
 #define MAX_RNG_TRIES   16U
 #define RNG_RDY_TIMEOUT 0x5000
 
+#if CONFIG_CRC32_HW_STM32
+static_assert(sizeof(uint32_t) < CRC_HW_MIN_LEN, "FIPS check CRC32 would map the CRC unit");
+#endif
+
 static bool rng_enabled;
 static bool not_first_rng;
 static uint32_t last_rng_crc;
@@ -121,11 +128,7 @@ err:
  *
  * Run the RNG to get a random number. return 0 if
  * generation is completed, or an error code if not.
- *
- * As explained in FIPS PUB, we discard the first
- * random number generated and compare each generation
- * to the next one. Each number has to be compared to
- * previous one and generation fails if they're equal.
+ * The RNG must be mapped.
  *
  * @param  random Random number buffer.
  * @return 0 if success, error code is failure.
@@ -133,7 +136,6 @@ err:
 static inline kstatus_t rng_load(uint32_t * random)
 {
     kstatus_t status = K_STATUS_OKAY;
-    uint32_t crc;
 
     /* Check RNG readyness first */
     if (unlikely((ioread32(RNG_BASE_ADDR + RNG_SR_REG) & RNG_SR_DRDY) == 0)) {
@@ -142,11 +144,33 @@ static inline kstatus_t rng_load(uint32_t * random)
     }
     /* read RNG number from RNG */
     *random = ioread32(RNG_BASE_ADDR + RNG_DR_REG);
+err:
+    return status;
+}
+
+/**
+ * @brief FIPS continuity test of a loaded random number
+ *
+ * As explained in FIPS PUB, we discard the first
+ * random number generated and compare each generation
+ * to the next one. Each number has to be compared to
+ * previous one and generation fails if they're equal.
+ *
+ * The CRC32 of a single random value is always computed in software, so that
+ * the RNG stays mapped during the whole draw.
+ *
+ * @param  random Random number buffer.
+ * @return 0 if success, error code is failure.
+ */
+static inline kstatus_t rng_fips_check(uint32_t const * random)
+{
+    kstatus_t status = K_STATUS_OKAY;
+    uint32_t crc;
 
     /* FIPS check: if first RNG or previous & current RNG identical,
      * FIPS error
      */
-    crc = crc32((uint8_t*)random, sizeof(uint32_t), 0xffffffffu);
+    crc = crc32((uint8_t const *)random, sizeof(uint32_t), 0xffffffffu);
     if (unlikely(not_first_rng == false)) {
         not_first_rng =true;
         /* instead of keeping the random value itself for FIPS compliance,
@@ -202,21 +226,25 @@ kstatus_t rng_get(uint32_t * random)
         status = K_ERROR_INVPARAM;
         goto err;
     }
-    if (unlikely((status = rng_map()) != K_STATUS_OKAY)) {
-        goto err;
-    }
     /*@ assert \valid(random); */
     /*@
       @ loop assigns status, max_rng_count;
       @ loop variant MAX_RNG_TRIES - max_rng_count ;
     */
+    if (unlikely((status = rng_map()) != K_STATUS_OKAY)) {
+        goto err;
+    }
     do {
         status = rng_load(random);
+        if (likely(status == K_STATUS_OKAY)) {
+            status = rng_fips_check(random);
+        }
         max_rng_count++;
         if (max_rng_count > MAX_RNG_TRIES) {
-            goto err;
+            goto unmap;
         }
     } while (status != K_STATUS_OKAY);
+unmap:
     rng_unmap();
 err:
     return status;
@@ -21,6 +21,7 @@
 #define LPUART_CR1_REG LPUART_CR1_DISABLED_REG
 #define LPUART_CR1_UE LPUART_CR1_DISABLED_UE
 #define LPUART_CR1_TE LPUART_CR1_DISABLED_TE
+#define LPUART_CR1_TXEIE LPUART_CR1_DISABLED_TXEIE
 #endif /* LPUART_CR1_DISABLED_REG */
 
 #if defined(LPUART_ISR_DISABLED_REG)
@@ -82,6 +83,25 @@ static void stm32_lpuart_wait_for_tx_empty(stm32_usartport_desc_t const *usart)
     while ((ioread32(usart->base_addr + LPUART_ISR_REG) & LPUART_ISR_TXE) == 0);
 }
 
+static bool stm32_lpuart_tx_is_empty(stm32_usartport_desc_t const *usart)
+{
+    return (ioread32(usart->base_addr + LPUART_ISR_REG) & LPUART_ISR_TXE) != 0;
+}
+
+static void stm32_lpuart_tx_irq_enable(stm32_usartport_desc_t const *usart)
+{
+    uint32_t cr1 = ioread32(usart->base_addr + LPUART_CR1_REG);
+    cr1 |= LPUART_CR1_TXEIE;
+    iowrite32(usart->base_addr + LPUART_CR1_REG, cr1);
+}
+
+static void stm32_lpuart_tx_irq_disable(stm32_usartport_desc_t const *usart)
+{
+    uint32_t cr1 = ioread32(usart->base_addr + LPUART_CR1_REG);
+    cr1 &= ~LPUART_CR1_TXEIE;
+    iowrite32(usart->base_addr + LPUART_CR1_REG, cr1);
+}
+
 static void __stm32_lpuart_clear_tx_done(stm32_usartport_desc_t const *usart)
 {
     iowrite32(usart->base_addr + LPUART_ICR_REG, LPUART_ICR_TCCF);
@@ -151,3 +171,6 @@ void usart_wait_for_tx_done(stm32_usartport_desc_t const *usart) __attribute__((
 kstatus_t usart_set_baudrate(stm32_usartport_desc_t const *usart) __attribute__((alias("stm32_lpuart_set_baudrate")));
 void usart_putc(const stm32_usartport_desc_t *usart, uint8_t c) __attribute__((alias("stm32_lpuart_putc")));
 void usart_setup(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_lpuart_setup")));
+bool usart_tx_is_empty(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_lpuart_tx_is_empty")));
+void usart_tx_irq_enable(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_lpuart_tx_irq_enable")));
+void usart_tx_irq_disable(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_lpuart_tx_irq_disable")));
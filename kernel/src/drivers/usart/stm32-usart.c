@@ -45,6 +45,7 @@
 #define USART_CR1_REG USART_CR1_DISABLED_REG
 #define USART_CR1_UE USART_CR1_DISABLED_UE
 #define USART_CR1_TE USART_CR1_DISABLED_TE
+#define USART_CR1_TXEIE USART_CR1_DISABLED_TXFNFIE
 #define USART_CR1_OVER8_SHIFT USART_CR1_DISABLED_OVER8_SHIFT
 #define USART_CR1_OVER8_MASK USART_CR1_DISABLED_OVER8_MASK
 /* receive & transmit registers separated. We only use transmit in kernel */
@@ -128,6 +129,34 @@ static void stm32_usart_tx_disable(stm32_usartport_desc_t const *usart)
     __stm32_usart_wait_te_ack(usart, false);
 }
 
+/**
+ * @brief TXE (Transmit Empty) bit is set, the data register can be written
+ */
+static bool stm32_usart_tx_is_empty(stm32_usartport_desc_t const *usart)
+{
+    return (ioread32(usart->base_addr + USART_SR_REG) & USART_SR_TXE) != 0;
+}
+
+/**
+ * @brief Enable the TXE (Transmit Empty) interrupt
+ */
+static void stm32_usart_tx_irq_enable(stm32_usartport_desc_t const *usart)
+{
+    uint32_t cr1 = ioread32(usart->base_addr + USART_CR1_REG);
+    cr1 |= USART_CR1_TXEIE;
+    iowrite32(usart->base_addr + USART_CR1_REG, cr1);
+}
+
+/**
+ * @brief Disable the TXE (Transmit Empty) interrupt
+ */
+static void stm32_usart_tx_irq_disable(stm32_usartport_desc_t const *usart)
+{
+    uint32_t cr1 = ioread32(usart->base_addr + USART_CR1_REG);
+    cr1 &= ~USART_CR1_TXEIE;
+    iowrite32(usart->base_addr + USART_CR1_REG, cr1);
+}
+
 /**
  * @brief Wait for TXE (Transmit Empty) bit to be set
  */
@@ -225,7 +254,7 @@ static void stm32_usart_putc(const stm32_usartport_desc_t *usart, uint8_t c)
 
 static void stm32_usart_setup(const stm32_usartport_desc_t *usart)
 {
-    /* standard 8n1 config is set with 0 value, FIXME: what about TIE interrupt ? */
+    /* standard 8n1 config is set with 0 value, TXE interrupt is enabled on demand */
     iowrite32(usart->base_addr + USART_CR1_REG, 0x0UL);
     /* sandard 8n1 config is set with 0 value in CR2 too */
     iowrite32(usart->base_addr + USART_CR2_REG, 0x0UL);
@@ -243,3 +272,6 @@ void usart_wait_for_tx_done(stm32_usartport_desc_t const *usart) __attribute__((
 kstatus_t usart_set_baudrate(stm32_usartport_desc_t const *usart) __attribute__((alias("stm32_usart_set_baudrate")));
 void usart_putc(const stm32_usartport_desc_t *usart, uint8_t c) __attribute__((alias("stm32_usart_putc")));
 void usart_setup(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_usart_setup")));
+bool usart_tx_is_empty(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_usart_tx_is_empty")));
+void usart_tx_irq_enable(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_usart_tx_irq_enable")));
+void usart_tx_irq_disable(const stm32_usartport_desc_t *usart) __attribute__((alias("stm32_usart_tx_irq_disable")));
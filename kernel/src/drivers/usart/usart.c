@@ -10,7 +10,9 @@
  * As a consequence, usart_rx and usart_tx manipuate uint8_t data only.
  */
 
+#include <string.h>
 #include <sentry/ktypes.h>
+#include <sentry/arch/asm-generic/interrupt.h>
 #include <sentry/arch/asm-cortex-m/layout.h>
 #include <sentry/arch/asm-cortex-m/irq_defs.h>
 #include <sentry/arch/asm-cortex-m/core.h>
@@ -23,8 +25,180 @@
 #include "usart_priv.h"
 #include "stm32-usart-dt.h"
 
+#if CONFIG_DEBUG_USART_ASYNC
+#define USART_RING_SIZE ((uint32_t)CONFIG_DEBUG_USART_ASYNC_RING_SIZE)
+#define USART_RING_MASK (USART_RING_SIZE - 1UL)
+
+static_assert((USART_RING_SIZE & USART_RING_MASK) == 0, "log ring size must be a power of 2");
+
+/**
+ * Asynchronous log ring. head and tail are free running indexes, the ring
+ * holds (head - tail) bytes.
+ * The ring is filled by kernel handlers and drained by the USART interrupt,
+ * which has the lowest priority level: none of them preempt each other, so
+ * that no locking is required.
+ */
+typedef struct usart_ring {
+    uint8_t  buf[USART_RING_SIZE];
+    uint32_t head;          /**< producer index */
+    uint32_t tail;          /**< consumer index */
+    uint32_t dropped;       /**< number of dropped logs */
+    uint32_t dropped_bytes; /**< number of dropped bytes */
+    bool     started;       /**< asynchronous mode started */
+    bool     draining;      /**< TXE interrupt enabled */
+} usart_ring_t;
+
+static usart_ring_t usart_ring;
+
+/**
+ * @brief push data to the log ring, and start draining if not already done
+ *
+ * Data that do not fit in the ring is dropped as a whole, so that the
+ * emitted logs are never truncated.
+ */
+static kstatus_t usart_tx_async(const uint8_t *data, size_t data_len)
+{
+    kstatus_t status = K_STATUS_OKAY;
+    stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
+    uint32_t head = usart_ring.head & USART_RING_MASK;
+    uint32_t chunk;
+
+    if (unlikely(data_len > (USART_RING_SIZE - (usart_ring.head - usart_ring.tail)))) {
+        usart_ring.dropped++;
+        usart_ring.dropped_bytes += data_len;
+        goto err;
+    }
+    chunk = USART_RING_SIZE - head;
+    if (chunk > data_len) {
+        chunk = data_len;
+    }
+    memcpy(&usart_ring.buf[head], data, chunk);
+    memcpy(&usart_ring.buf[0], &data[chunk], data_len - chunk);
+    usart_ring.head += data_len;
+    if (!usart_ring.draining) {
+        if (unlikely((status = usart_map()) != K_STATUS_OKAY)) {
+            goto err;
+        }
+        usart_ring.draining = true;
+        usart_tx_irq_enable(usart);
+        status = usart_unmap();
+    }
+err:
+    return status;
+}
+
+/**
+ * @brief start the asynchronous log output
+ *
+ * The USART is configured and enabled once for all, and its interrupt is set
+ * to the lowest priority level, so that it never delays other kernel handlers.
+ * Those may preempt it before its kernel section masks interrupts, the nested
+ * exception check of the deferred context switch ensuring that they do not
+ * switch the task context under it (see CONFIG_SCHED_DEFERRED_SWITCH).
+ *
+ * @return K_ERROR_NOENT if the USART has no interrupt declared, in which case
+ *   logs stay synchronous, K_STATUS_OKAY otherwise
+ */
+kstatus_t usart_tx_async_start(void)
+{
+    kstatus_t status = K_ERROR_NOENT;
+    stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
+
+    if (unlikely(usart->irqn == USART_NO_IRQN)) {
+        goto err;
+    }
+    if (unlikely((status = usart_map()) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    usart_set_baudrate(usart);
+    usart_enable(usart);
+    usart_tx_enable(usart);
+    if (unlikely((status = usart_unmap()) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    interrupt_set_priority((int32_t)usart->irqn, INTERRUPT_LOWEST_PRIORITY);
+    interrupt_clear_pendingirq(usart->irqn);
+    interrupt_enable_irq(usart->irqn);
+    usart_ring.started = true;
+err:
+    return status;
+}
+
+/**
+ * @brief return true if IRQn is the log USART interrupt
+ */
+bool usart_tx_is_irq(uint32_t IRQn)
+{
+    stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
+    return usart_ring.started && (IRQn == usart->irqn);
+}
+
+/**
+ * @brief log USART interrupt handler, fill the transmit register from the ring
+ *
+ * The TXE interrupt is disabled once the ring is empty.
+ */
+void usart_tx_irq_handler(void)
+{
+    stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
+
+    if (unlikely(usart_map() != K_STATUS_OKAY)) {
+        return;
+    }
+    while ((usart_ring.tail != usart_ring.head) && usart_tx_is_empty(usart)) {
+        usart_putc(usart, usart_ring.buf[usart_ring.tail & USART_RING_MASK]);
+        usart_ring.tail++;
+    }
+    if (usart_ring.tail == usart_ring.head) {
+        usart_tx_irq_disable(usart);
+        usart_ring.draining = false;
+    }
+    usart_unmap();
+}
+
+/**
+ * @brief synchronously emit the ring content, and go back to synchronous logs
+ *
+ * Used at panic time, when the USART interrupt will never be executed again.
+ */
+void usart_tx_flush(void)
+{
+    stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
+
+    if (!usart_ring.started) {
+        return;
+    }
+    usart_ring.started = false;
+    interrupt_disable_irq(usart->irqn);
+    if (unlikely(usart_map() != K_STATUS_OKAY)) {
+        return;
+    }
+    usart_tx_irq_disable(usart);
+    usart_ring.draining = false;
+    while (usart_ring.tail != usart_ring.head) {
+        usart_wait_for_tx_empty(usart);
+        usart_putc(usart, usart_ring.buf[usart_ring.tail & USART_RING_MASK]);
+        usart_ring.tail++;
+    }
+    usart_wait_for_tx_done(usart);
+    usart_unmap();
+}
+
+/**
+ * @brief get back the number of logs and bytes dropped because of a full ring
+ */
+void usart_tx_get_dropped(uint32_t *logs, uint32_t *bytes)
+{
+    *logs = usart_ring.dropped;
+    *bytes = usart_ring.dropped_bytes;
+}
+#endif
+
 /**
  * @brief sending data over USART
+ *
+ * With CONFIG_DEBUG_USART_ASYNC, once the asynchronous mode is started, data
+ * is pushed to the log ring and this function never blocks.
  */
 /*@
   requires \valid_read(data + (0 .. data_len-1));
@@ -36,6 +210,13 @@ kstatus_t usart_tx(const uint8_t *data, size_t data_len)
     stm32_usartport_desc_t const *usart = stm32_usartport_get_desc();
     size_t emitted = 0;
 
+#if CONFIG_DEBUG_USART_ASYNC
+    if (usart_ring.started) {
+        status = usart_tx_async(data, data_len);
+        goto err;
+    }
+#endif
+
     if (unlikely((status = usart_map()) != K_STATUS_OKAY)) {
         goto err;
     }
@@ -4,6 +4,7 @@
 #ifndef __DRIVERS_USART_PRIV_H
 #define __DRIVERS_USART_PRIV_H
 
+#include <stdbool.h>
 #include <sentry/ktypes.h>
 #include <sentry/managers/memory.h>
 
@@ -29,5 +30,8 @@ void usart_tx_disable(const stm32_usartport_desc_t *usart);
 void usart_wait_for_tx_empty(const stm32_usartport_desc_t *usart);
 void usart_wait_for_tx_done(const stm32_usartport_desc_t *usart);
 void usart_putc(const stm32_usartport_desc_t *usart, uint8_t c);
+bool usart_tx_is_empty(const stm32_usartport_desc_t *usart);
+void usart_tx_irq_enable(const stm32_usartport_desc_t *usart);
+void usart_tx_irq_disable(const stm32_usartport_desc_t *usart);
 
 #endif /* __DRIVERS_USART_PRIV_H */
@@ -0,0 +1,315 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file binary kernel logs (CONFIG_DEBUG_BINARY_LOG)
+ *
+ * pr_xxx() format strings are stored in the .logfmt section at build time.
+ * Instead of formatting the log on target, a record is emitted, made of:
+ *
+ * | magic (0xff) | payload len (u8) | format id (u16) | payload |
+ *
+ * The format identifier is the format string offset in the .logfmt section.
+ * The payload holds the raw arguments, in format string order, little endian:
+ * - 32 bits words for integers, chars and pointers
+ * - 64 bits words for long long integers
+ * - for strings, the string address if it is located in flash, otherwise a
+ *   null word followed by the string length (u8) and the string bytes,
+ *   truncated to BINLOG_STR_MAX
+ *
+ * - a '*' width or precision is emitted as a 32 bits word, before the
+ *   argument it applies to
+ *
+ * The format string is only scanned for its conversion specifiers, no
+ * formatting is done on target. Records are decoded on host by
+ * tools/binlog_decode.py, using the kernel ELF file. As text logs only hold
+ * ASCII characters, the 0xff magic is used by the decoder to separate records
+ * from text logs.
+ *
+ * Records are queued into a record ring, drained by whole records when the
+ * idle task is scheduled and periodically from the systick handler, instead of
+ * being emitted on the debug output from the logging handler. Until userspace
+ * is spawned, the ring is drained synchronously when a record does not fit,
+ * so that no boot log is lost. Afterward, records that do not fit are dropped
+ * and a drop record (BINLOG_DROP_ID, number of dropped records as payload) is
+ * queued before the next accepted one.
+ *
+ * The ring is filled and drained from kernel handlers, which never preempt
+ * each other, so that no locking is required.
+ */
+
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <sentry/ktypes.h>
+#include <sentry/managers/debug.h>
+
+#define BINLOG_MAGIC      0xffU
+#define BINLOG_HEADER_LEN 4U
+/* header included, the payload length is a u8 */
+#define BINLOG_RECORD_MAX (BINLOG_HEADER_LEN + 255U)
+#define BINLOG_STR_MAX    32U
+/* format identifier reserved for drop records, see linker script assertion */
+#define BINLOG_DROP_ID    0xffffU
+
+#define BINLOG_RING_SIZE  ((uint32_t)CONFIG_DEBUG_BINARY_LOG_RING_SIZE)
+#define BINLOG_RING_MASK  (BINLOG_RING_SIZE - 1UL)
+
+#ifndef TEST_MODE
+/* linker script symbols */
+extern const char _stext[];
+extern const char _etext[];
+extern const char _slogfmt[];
+extern const char _elogfmt[];
+#else
+/* host tests provide the format strings and the flash strings areas */
+extern const char *_stext;
+extern const char *_etext;
+extern const char *_slogfmt;
+extern const char *_elogfmt;
+#endif
+
+/* task manager API, declared here to avoid the task manager generated headers */
+secure_bool_t mgr_task_is_userspace_spawned(void);
+
+static_assert((BINLOG_RING_SIZE & BINLOG_RING_MASK) == 0, "binary log ring size must be a power of 2");
+static_assert(BINLOG_RING_SIZE >= (2 * BINLOG_RECORD_MAX), "binary log ring must hold a full length record");
+
+typedef struct binlog_record {
+    uint8_t buf[BINLOG_RECORD_MAX];
+    uint32_t len;
+} binlog_record_t;
+
+/**
+ * Binary log record ring. head and tail are free running indexes, the ring
+ * holds (head - tail) bytes, made of whole records only.
+ */
+typedef struct binlog_ring {
+    uint8_t buf[BINLOG_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;  /**< dropped records since the last accepted one */
+} binlog_ring_t;
+
+/* as the printk() buffer, kernel logs are never reentrant */
+static binlog_record_t binlog_rec;
+static binlog_ring_t binlog_ring;
+#if CONFIG_DEBUG_BINARY_LOG_TICK_PERIOD > 0
+static uint32_t binlog_ticks;
+#endif
+
+static inline void binlog_put(binlog_record_t *rec, const void *data, uint32_t len)
+{
+    /* arguments that do not fit are dropped, the decoder detects the short payload */
+    if (likely((rec->len + len) <= BINLOG_RECORD_MAX)) {
+        memcpy(&rec->buf[rec->len], data, len);
+        rec->len += len;
+    }
+}
+
+static inline void binlog_put_u32(binlog_record_t *rec, uint32_t val)
+{
+    binlog_put(rec, &val, sizeof(val));
+}
+
+static inline void binlog_put_str(binlog_record_t *rec, const char *str)
+{
+    uint8_t len = 0;
+
+    if ((str >= _stext && str < _etext) || (str >= _slogfmt && str < _elogfmt)) {
+        /* flash located, resolved by the decoder from the ELF file */
+        binlog_put_u32(rec, (uint32_t)(uintptr_t)str);
+        return;
+    }
+    binlog_put_u32(rec, 0UL);
+    if (str != NULL) {
+        while ((len < BINLOG_STR_MAX) && (str[len] != '\0')) {
+            len++;
+        }
+    }
+    binlog_put(rec, &len, sizeof(len));
+    if (len > 0) {
+        binlog_put(rec, str, len);
+    }
+}
+
+static inline uint32_t binlog_ring_free(void)
+{
+    return BINLOG_RING_SIZE - (binlog_ring.head - binlog_ring.tail);
+}
+
+static void binlog_ring_put(const uint8_t *data, uint32_t len)
+{
+    uint32_t head = binlog_ring.head & BINLOG_RING_MASK;
+    uint32_t chunk = BINLOG_RING_SIZE - head;
+
+    if (chunk > len) {
+        chunk = len;
+    }
+    memcpy(&binlog_ring.buf[head], data, chunk);
+    memcpy(&binlog_ring.buf[0], &data[chunk], len - chunk);
+    binlog_ring.head += len;
+}
+
+/**
+ * @brief queue the built record, preceded by a drop record if needed
+ *
+ * @return K_ERROR_BUSY if the record is dropped, K_STATUS_OKAY otherwise
+ */
+static kstatus_t binlog_push(const binlog_record_t *rec)
+{
+    kstatus_t status = K_ERROR_BUSY;
+    uint8_t drop[BINLOG_HEADER_LEN + sizeof(uint32_t)] = {
+        BINLOG_MAGIC, sizeof(uint32_t), BINLOG_DROP_ID & 0xffU, BINLOG_DROP_ID >> 8,
+    };
+    uint32_t drop_len = (binlog_ring.dropped > 0) ? sizeof(drop) : 0;
+
+    if (unlikely((rec->len + drop_len) > binlog_ring_free())) {
+        if (mgr_task_is_userspace_spawned() == SECURE_TRUE) {
+            binlog_ring.dropped++;
+            goto err;
+        }
+        /* boot time, no deferred emission point yet */
+        mgr_debug_binlog_drain(SIZE_MAX);
+    }
+    if (drop_len > 0) {
+        memcpy(&drop[BINLOG_HEADER_LEN], &binlog_ring.dropped, sizeof(uint32_t));
+        binlog_ring_put(drop, drop_len);
+        binlog_ring.dropped = 0;
+    }
+    binlog_ring_put(rec->buf, rec->len);
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+/**
+ * @brief queue a binary log record
+ *
+ * @param[in] fmt format string, located in the .logfmt section
+ *
+ * @return K_ERROR_INVPARAM if fmt is not a .logfmt string, K_ERROR_BUSY if the
+ *  record is dropped, K_STATUS_OKAY otherwise
+ */
+__attribute__ ((format (printf, 1, 2))) kstatus_t binlog_emit(const char *fmt, ...)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    uint16_t id;
+    uint8_t longs;
+    va_list args;
+
+    if (unlikely((fmt < _slogfmt) || (fmt >= _elogfmt))) {
+        goto err;
+    }
+    id = (uint16_t)(fmt - _slogfmt);
+    binlog_rec.buf[0] = BINLOG_MAGIC;
+    memcpy(&binlog_rec.buf[2], &id, sizeof(id));
+    binlog_rec.len = BINLOG_HEADER_LEN;
+
+    va_start(args, fmt);
+    while (*fmt != '\0') {
+        if (*fmt++ != '%') {
+            continue;
+        }
+        /* flags, width and precision, only a '*' consumes an int argument */
+        while ((*fmt == '0') || (*fmt == '-') || (*fmt == '+') || (*fmt == ' ') ||
+               (*fmt == '#') || (*fmt == '.') || (*fmt == '*') ||
+               ((*fmt >= '1') && (*fmt <= '9'))) {
+            if (*fmt == '*') {
+                binlog_put_u32(&binlog_rec, (uint32_t)va_arg(args, int));
+            }
+            fmt++;
+        }
+        longs = 0;
+        while ((*fmt == 'l') || (*fmt == 'h') || (*fmt == 'z')) {
+            if (*fmt == 'l') {
+                longs++;
+            }
+            fmt++;
+        }
+        switch (*fmt) {
+            case '\0':
+                goto end;
+            case '%':
+                break;
+            case 's':
+                binlog_put_str(&binlog_rec, va_arg(args, const char *));
+                break;
+            case 'p':
+                binlog_put_u32(&binlog_rec, (uint32_t)(uintptr_t)va_arg(args, void *));
+                break;
+            default:
+                if (longs > 1) {
+                    uint64_t val = va_arg(args, unsigned long long);
+                    binlog_put(&binlog_rec, &val, sizeof(val));
+                } else {
+                    binlog_put_u32(&binlog_rec, va_arg(args, uint32_t));
+                }
+                break;
+        }
+        fmt++;
+    }
+end:
+    va_end(args);
+    binlog_rec.buf[1] = (uint8_t)(binlog_rec.len - BINLOG_HEADER_LEN);
+    status = binlog_push(&binlog_rec);
+err:
+    return status;
+}
+
+/**
+ * @brief emit queued records on the debug output
+ *
+ * Only whole records are emitted, so that text logs are never emitted in the
+ * middle of a record. At least one record is emitted, even if larger than max.
+ *
+ * @return SECURE_TRUE if the ring is empty
+ */
+secure_bool_t mgr_debug_binlog_drain(size_t max)
+{
+    uint32_t pending = binlog_ring.head - binlog_ring.tail;
+    size_t emitted = 0;
+    uint32_t tail;
+    uint32_t len;
+    uint32_t chunk;
+
+    while (pending > 0) {
+        tail = binlog_ring.tail & BINLOG_RING_MASK;
+        len = BINLOG_HEADER_LEN + binlog_ring.buf[(tail + 1UL) & BINLOG_RING_MASK];
+        if ((emitted > 0) && ((emitted + len) > max)) {
+            break;
+        }
+        chunk = BINLOG_RING_SIZE - tail;
+        if (chunk > len) {
+            chunk = len;
+        }
+        debug_rawlog(&binlog_ring.buf[tail], chunk);
+        if (chunk < len) {
+            /* record wrapping at ring end */
+            debug_rawlog(&binlog_ring.buf[0], len - chunk);
+        }
+        binlog_ring.tail += len;
+        pending -= len;
+        emitted += len;
+    }
+    return (pending == 0) ? SECURE_TRUE : SECURE_FALSE;
+}
+
+/**
+ * @brief emit a bounded amount of queued records, periodically
+ *
+ * Called at each systick, drains about CONFIG_DEBUG_BINARY_LOG_DRAIN_CHUNK
+ * bytes every CONFIG_DEBUG_BINARY_LOG_TICK_PERIOD ticks, so that records are
+ * emitted even if the idle task is never scheduled.
+ */
+void mgr_debug_binlog_tick(void)
+{
+#if CONFIG_DEBUG_BINARY_LOG_TICK_PERIOD > 0
+    if (++binlog_ticks < CONFIG_DEBUG_BINARY_LOG_TICK_PERIOD) {
+        return;
+    }
+    binlog_ticks = 0;
+    mgr_debug_binlog_drain(CONFIG_DEBUG_BINARY_LOG_DRAIN_CHUNK);
+#endif
+}
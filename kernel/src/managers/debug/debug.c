@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
 #include <sentry/ktypes.h>
 #include <bsp/drivers/usart/usart.h>
 #include <bsp/drivers/clk/rcc.h>
@@ -9,6 +11,7 @@
 #if CONFIG_DEBUG_OUTPUT_SEMIHOSTING
 #include <sentry/arch/asm-cortex-m/semihosting.h>
 #endif
+#include <sentry/managers/debug.h>
 #include "log.h"
 
 /**
@@ -36,6 +39,171 @@ end:
     return status;
 }
 
+#if CONFIG_DEBUG_USART_ASYNC
+/**
+ * @brief switch the debug output to asynchronous mode
+ *
+ * Called once the kernel is initialized, just before spawning userspace. Logs
+ * emitted during the boot sequence are synchronous.
+ */
+kstatus_t mgr_debug_async_start(void)
+{
+    kstatus_t status = usart_tx_async_start();
+    if (unlikely(status != K_STATUS_OKAY)) {
+        pr_warn("no USART interrupt, keeping synchronous logs");
+    }
+    return status;
+}
+
+/**
+ * @brief return SECURE_TRUE if IRQn is the asynchronous log output interrupt
+ */
+secure_bool_t mgr_debug_is_log_irq(uint32_t IRQn)
+{
+    return usart_tx_is_irq(IRQn) ? SECURE_TRUE : SECURE_FALSE;
+}
+
+/**
+ * @brief asynchronous log output interrupt handler
+ */
+void mgr_debug_log_irq_handler(void)
+{
+    usart_tx_irq_handler();
+}
+#endif
+
+#if CONFIG_DEBUG_OUTPUT_SEMIHOSTING
+/*
+ * XXX:
+ * Filename must be aligned on word boundary as it is use as semi-hosted syscall arguments,
+ * Which is an array of int, and thus must be aligned.
+ */
+#ifndef __FRAMAC__
+/** NOTE: Frama-C do not yet support C11 _Alignas */
+_Alignas(size_t)
+#endif
+static const char semihosting_filename[] = CONFIG_DEBUG_SEMIHOSTING_OUTPUT_FILE;
+
+/* host file descriptor, opened at first use and never closed */
+static int semihosting_fd = -1;
+
+#if CONFIG_DEBUG_SEMIHOSTING_BUFFERED
+typedef struct semihosting_buffer {
+    char buf[CONFIG_DEBUG_SEMIHOSTING_BUFFER_SIZE];
+    size_t len;
+} semihosting_buffer_t;
+
+static semihosting_buffer_t semihosting_buffer;
+#endif
+
+static kstatus_t semihosting_write(const char *buf, size_t len)
+{
+    kstatus_t status = K_ERROR_NOENT;
+
+    if (unlikely(semihosting_fd < 0)) {
+        semihosting_fd = arm_semihosting_open(semihosting_filename, SYS_FILE_MODE_APPEND,
+                                              sizeof(semihosting_filename) - 1);
+        if (unlikely(semihosting_fd < 0)) {
+            goto err;
+        }
+    }
+    if (unlikely(arm_semihosting_write(semihosting_fd, buf, len) != 0)) {
+        /* host side failure, the file is reopened at next write */
+        arm_semihosting_close(semihosting_fd);
+        semihosting_fd = -1;
+        goto err;
+    }
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+#if CONFIG_DEBUG_SEMIHOSTING_BUFFERED
+static kstatus_t semihosting_buffer_flush(void)
+{
+    kstatus_t status = K_STATUS_OKAY;
+
+    if (semihosting_buffer.len > 0) {
+        status = semihosting_write(semihosting_buffer.buf, semihosting_buffer.len);
+        /* on host failure, pending logs are dropped rather than accumulated */
+        semihosting_buffer.len = 0;
+    }
+    return status;
+}
+
+/**
+ * @brief buffer a log, the buffer is written to the host file when full
+ *
+ * Logs that are bigger than the buffer itself are directly written.
+ */
+static kstatus_t semihosting_buffered_write(const uint8_t *logbuf, size_t len)
+{
+    kstatus_t status = K_STATUS_OKAY;
+
+    if ((semihosting_buffer.len + len) > sizeof(semihosting_buffer.buf)) {
+        status = semihosting_buffer_flush();
+    }
+    if (len >= sizeof(semihosting_buffer.buf)) {
+        status = semihosting_write((const char *)logbuf, len);
+        goto end;
+    }
+    memcpy(&semihosting_buffer.buf[semihosting_buffer.len], logbuf, len);
+    semihosting_buffer.len += len;
+    if (semihosting_buffer.len == sizeof(semihosting_buffer.buf)) {
+        status = semihosting_buffer_flush();
+    }
+end:
+    return status;
+}
+#endif
+#endif
+
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+/**
+ * @brief synchronously emit pending logs, called at panic time
+ */
+void mgr_debug_flush(void)
+{
+#if CONFIG_DEBUG_BINARY_LOG
+    mgr_debug_binlog_drain(SIZE_MAX);
+#endif
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+    mgr_debug_userlog_drain(SIZE_MAX);
+#endif
+#if CONFIG_DEBUG_USART_ASYNC
+    usart_tx_flush();
+#elif CONFIG_DEBUG_SEMIHOSTING_BUFFERED
+    semihosting_buffer_flush();
+#endif
+}
+
+/**
+ * @brief emit pending logs while idle is scheduled
+ *
+ * Called each time the idle task yields or enters a CPU sleep state. The
+ * amount of kernel binary logs and userspace logs emitted is bounded, so that
+ * a task waking up is not delayed by a full log ring emission.
+ */
+void mgr_debug_idle(void)
+{
+#if CONFIG_DEBUG_BINARY_LOG
+    if (mgr_debug_binlog_drain(CONFIG_DEBUG_BINARY_LOG_DRAIN_CHUNK) != SECURE_TRUE) {
+        /* keep buffered output for the next chunks */
+        return;
+    }
+#endif
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+    if (mgr_debug_userlog_drain(CONFIG_DEBUG_USER_LOG_DRAIN_CHUNK) != SECURE_TRUE) {
+        /* keep buffered output for the next chunks */
+        return;
+    }
+#endif
+#if CONFIG_DEBUG_SEMIHOSTING_BUFFERED
+    semihosting_buffer_flush();
+#endif
+}
+#endif
+
 /**
  * @brief raw log export, abstracting the selected output log device
  *
@@ -49,28 +217,10 @@ kstatus_t debug_rawlog(__MAYBE_UNUSED const uint8_t *logbuf, __MAYBE_UNUSED size
 #if CONFIG_DEBUG_OUTPUT_USART
     /* usart as no notion of the byte type it emit. sending unsigned content */
     return usart_tx(logbuf, len);
+#elif CONFIG_DEBUG_SEMIHOSTING_BUFFERED
+    return semihosting_buffered_write(logbuf, len);
 #elif CONFIG_DEBUG_OUTPUT_SEMIHOSTING
-    kstatus_t status = K_ERROR_NOENT;
-    /*
-     * XXX:
-     * Filename must be aligned on word boundary as it is use as semi-hosted syscall arguments,
-     * Which is an array of int, and thus must be aligned.
-     */
-#ifndef __FRAMAC__
-    /** NOTE: Frama-C do not yet support C11 _Alignas */
-    _Alignas(size_t)
-#endif
-    static const char filename[] = CONFIG_DEBUG_SEMIHOSTING_OUTPUT_FILE;
-    int fd;
-
-    fd = arm_semihosting_open(filename, SYS_FILE_MODE_APPEND, sizeof(filename) - 1);
-    if (fd < 0) {
-        goto err;
-    }
-    arm_semihosting_write(fd, logbuf, len);
-    arm_semihosting_close(fd);
-err:
-    return status;
+    return semihosting_write((const char *)logbuf, len);
 #else
     /* in release or no output mode, if called, just do nothing */
     return K_STATUS_OKAY;
@@ -81,6 +231,13 @@ err:
 kstatus_t mgr_debug_autotest(void)
 {
     kstatus_t status = K_STATUS_OKAY;
+#if CONFIG_DEBUG_USART_ASYNC
+    uint32_t logs;
+    uint32_t bytes;
+
+    usart_tx_get_dropped(&logs, &bytes);
+    pr_autotest("async log dropped: %lu logs, %lu bytes", logs, bytes);
+#endif
     return status;
 }
 #endif
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file EXTI software interrupt based latency probe, debug builds only
+ *
+ * The probe interrupt is kernel owned, and delivered to the task that armed
+ * the probe as any user interrupt. Three timestamps are taken:
+ * - at trigger time (EXTI software interrupt generation)
+ * - at kernel user interrupt handler entry
+ * - when the owner returns from wait_for_event() with the probe interrupt
+ *
+ * The kernel entry (trigger to handler) and owner wake-up (handler to
+ * wait_for_event() return) latencies are recorded as kernel statistics.
+ * All functions are called from kernel handlers, which never preempt each
+ * other, so that no locking is required here.
+ */
+#include <sentry/ktypes.h>
+#include <sentry/managers/debug.h>
+#include <sentry/arch/asm-generic/interrupt.h>
+#include <sentry/arch/asm-generic/tick.h>
+#include <bsp/drivers/exti/exti.h>
+#include <uapi/types.h>
+
+#define IRQPROBE_LINE ((uint8_t)CONFIG_DEBUG_IRQ_PROBE_EXTI_LINE)
+
+typedef struct irqprobe_state {
+    taskh_t owner;        /**< task that armed the probe */
+    uint32_t irqn;        /**< probe NVIC interrupt line */
+    uint32_t ticks;       /**< remaining ticks before trigger, 0 if triggered */
+    uint32_t trigger;     /**< trigger timestamp, in cycles */
+    uint32_t entry;       /**< kernel handler entry timestamp, in cycles */
+    secure_bool_t armed;  /**< armed and not yet delivered */
+} irqprobe_state_t;
+
+static irqprobe_state_t irqprobe = {
+    .irqn = UINT32_MAX,
+    .armed = SECURE_FALSE,
+};
+
+static inline void irqprobe_trigger(void)
+{
+    irqprobe.trigger = systime_get_cyclel();
+    if (unlikely(exti_generate_swinterrupt(IRQPROBE_LINE) != K_STATUS_OKAY)) {
+        /* previous trigger still pending, drop this one */
+        irqprobe.armed = SECURE_FALSE;
+    }
+}
+
+/**
+ * @brief arm the latency probe
+ *
+ * @param[in] owner: task to which the probe interrupt is delivered
+ * @param[in] ticks: number of systicks before the trigger, 0 for an
+ *  immediate trigger, executed at current kernel handler exit
+ *
+ * @return K_ERROR_BUSY if the probe is already armed, K_ERROR_BADSTATE if the
+ *  EXTI line is not usable, K_STATUS_OKAY otherwise
+ */
+kstatus_t mgr_debug_irqprobe_arm(taskh_t owner, uint32_t ticks)
+{
+    kstatus_t status = K_ERROR_BUSY;
+
+    if (unlikely(irqprobe.armed == SECURE_TRUE)) {
+        goto err;
+    }
+    if (unlikely(irqprobe.irqn == UINT32_MAX)) {
+        /* first usage, configure the EXTI line and its NVIC interrupt */
+        status = K_ERROR_BADSTATE;
+        if (unlikely(exti_get_irqn(IRQPROBE_LINE, &irqprobe.irqn) != K_STATUS_OKAY)) {
+            goto err;
+        }
+        if (unlikely(exti_unmask_interrupt(IRQPROBE_LINE) != K_STATUS_OKAY)) {
+            irqprobe.irqn = UINT32_MAX;
+            goto err;
+        }
+        interrupt_enable_irq(irqprobe.irqn);
+    }
+    irqprobe.owner = owner;
+    irqprobe.ticks = ticks;
+    irqprobe.armed = SECURE_TRUE;
+    if (ticks == 0) {
+        irqprobe_trigger();
+    }
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+/**
+ * @brief delayed trigger management, called at each systick
+ *
+ * As the trigger is made at a tick boundary, the owner can sample the various
+ * quantum phases by varying the number of ticks.
+ */
+void mgr_debug_irqprobe_tick(void)
+{
+    if ((irqprobe.armed == SECURE_TRUE) && (irqprobe.ticks != 0)) {
+        irqprobe.ticks--;
+        if (irqprobe.ticks == 0) {
+            irqprobe_trigger();
+        }
+    }
+}
+
+secure_bool_t mgr_debug_irqprobe_is_probe(uint32_t IRQn)
+{
+    secure_bool_t res = SECURE_FALSE;
+    if (IRQn == irqprobe.irqn) {
+        res = SECURE_TRUE;
+    }
+    return res;
+}
+
+/**
+ * @brief probe interrupt kernel handler
+ *
+ * Acknowledge the probe interrupt and record the kernel entry latency.
+ *
+ * @param[in] IRQn: probe interrupt line
+ * @param[out] owner: task to which the interrupt must be delivered
+ *
+ * @return K_ERROR_NOENT for a spurious probe interrupt (not armed), to be
+ *  ignored, K_STATUS_OKAY otherwise
+ */
+kstatus_t mgr_debug_irqprobe_handler(uint32_t IRQn, taskh_t *owner)
+{
+    kstatus_t status = K_ERROR_NOENT;
+    uint32_t entry = systime_get_cyclel();
+
+    exti_clear_pending(IRQPROBE_LINE);
+    interrupt_clear_pendingirq(IRQn);
+    if (unlikely(irqprobe.armed != SECURE_TRUE)) {
+        goto err;
+    }
+    irqprobe.entry = entry;
+    mgr_debug_kstat_record(KERNEL_STAT_IRQ_PROBE_ENTRY, 0, entry - irqprobe.trigger);
+    *owner = irqprobe.owner;
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+/**
+ * @brief probe interrupt returned to its owner by wait_for_event()
+ *
+ * Record the owner wake-up latency and disarm the probe.
+ */
+void mgr_debug_irqprobe_delivered(uint32_t IRQn)
+{
+    if ((IRQn != irqprobe.irqn) || (irqprobe.armed != SECURE_TRUE)) {
+        goto end;
+    }
+    mgr_debug_kstat_record(KERNEL_STAT_IRQ_PROBE_WAKEUP, 0,
+                           systime_get_cyclel() - irqprobe.entry);
+    irqprobe.armed = SECURE_FALSE;
+end:
+    return;
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file kernel statistics recording, debug and autotest builds only
+ *
+ * Statistics are recorded from kernel handlers only, which never preempt each
+ * other, so that no locking is required here.
+ */
+#include <string.h>
+#include <sentry/ktypes.h>
+#include <sentry/managers/debug.h>
+#include <uapi/types.h>
+
+#define KSTAT_INIT { .min = UINT32_MAX, }
+
+static kernel_stat_infos_t kstat_masked_window = KSTAT_INIT;
+static kernel_stat_infos_t kstat_systick = KSTAT_INIT;
+static kernel_stat_infos_t kstat_user_irq = KSTAT_INIT;
+static kernel_stat_infos_t kstat_irq_probe_entry = KSTAT_INIT;
+static kernel_stat_infos_t kstat_irq_probe_wakeup = KSTAT_INIT;
+static kernel_stat_infos_t kstat_mpu_load = KSTAT_INIT;
+static kernel_stat_infos_t kstat_syscalls[KSTAT_SYSCALL_NUM] = {
+    [0 ... (KSTAT_SYSCALL_NUM - 1)] = KSTAT_INIT,
+};
+
+/**
+ * @brief get back the statistic slot associated to given stat and index
+ *
+ * @return the statistic slot address, or NULL if it do not exist
+ */
+static inline kernel_stat_infos_t *kstat_get_slot(uint32_t stat, uint32_t index)
+{
+    kernel_stat_infos_t *slot = NULL;
+
+    switch (stat) {
+        case KERNEL_STAT_MASKED_WINDOW:
+            if (likely(index == 0)) {
+                slot = &kstat_masked_window;
+            }
+            break;
+        case KERNEL_STAT_SYSCALL:
+            if (likely(index < KSTAT_SYSCALL_NUM)) {
+                slot = &kstat_syscalls[index];
+            }
+            break;
+        case KERNEL_STAT_SYSTICK:
+            if (likely(index == 0)) {
+                slot = &kstat_systick;
+            }
+            break;
+        case KERNEL_STAT_USER_IRQ:
+            if (likely(index == 0)) {
+                slot = &kstat_user_irq;
+            }
+            break;
+        case KERNEL_STAT_IRQ_PROBE_ENTRY:
+            if (likely(index == 0)) {
+                slot = &kstat_irq_probe_entry;
+            }
+            break;
+        case KERNEL_STAT_IRQ_PROBE_WAKEUP:
+            if (likely(index == 0)) {
+                slot = &kstat_irq_probe_wakeup;
+            }
+            break;
+        case KERNEL_STAT_MPU_LOAD:
+            if (likely(index == 0)) {
+                slot = &kstat_mpu_load;
+            }
+            break;
+        default:
+            break;
+    }
+    return slot;
+}
+
+/**
+ * @brief record a new value for a given kernel statistic
+ *
+ * Unknown statistics are silently ignored.
+ *
+ * @param[in] stat: statistic identifier, as defined in KernelStat
+ * @param[in] index: statistic index, for arrays of statistics. 0 otherwise
+ * @param[in] cycles: value to record, in cycles
+ */
+void mgr_debug_kstat_record(uint32_t stat, uint32_t index, uint32_t cycles)
+{
+    kernel_stat_infos_t *slot = kstat_get_slot(stat, index);
+
+    if (unlikely(slot == NULL)) {
+        goto end;
+    }
+    slot->count++;
+    slot->total += cycles;
+    slot->last = cycles;
+    if (cycles < slot->min) {
+        slot->min = cycles;
+    }
+    if (cycles > slot->max) {
+        slot->max = cycles;
+    }
+end:
+    return;
+}
+
+/**
+ * @brief get back a copy of a given kernel statistic
+ *
+ * @param[in] stat: statistic identifier, as defined in KernelStat
+ * @param[in] index: statistic index, for arrays of statistics. 0 otherwise
+ * @param[out] infos: statistic copy
+ *
+ * @return K_ERROR_INVPARAM if infos is NULL, K_ERROR_NOENT if the statistic
+ *  do not exist, K_STATUS_OKAY otherwise
+ */
+kstatus_t mgr_debug_kstat_get(uint32_t stat, uint32_t index, kernel_stat_infos_t *infos)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kernel_stat_infos_t *slot;
+
+    if (unlikely(infos == NULL)) {
+        goto err;
+    }
+    slot = kstat_get_slot(stat, index);
+    if (unlikely(slot == NULL)) {
+        status = K_ERROR_NOENT;
+        goto err;
+    }
+    memcpy(infos, slot, sizeof(kernel_stat_infos_t));
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
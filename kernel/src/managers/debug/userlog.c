@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file deferred userspace logs (CONFIG_DEBUG_USER_LOG_DEFERRED)
+ *
+ * sys_log() contents are copied into a kernel log ring, drained by chunks
+ * when the idle task is scheduled and periodically from the systick handler,
+ * instead of being synchronously emitted on the debug output from the syscall
+ * handler.
+ *
+ * Each task log rate is limited using a per task byte credit (token bucket),
+ * refilled at CONFIG_DEBUG_USER_LOG_RATE bytes per second, up to
+ * CONFIG_DEBUG_USER_LOG_BURST bytes. Logs that exceed the task credit or do
+ * not fit in the ring are dropped and accounted. The number of dropped logs is
+ * reported in the log stream, before the next accepted log of the task.
+ *
+ * The ring is filled and drained from kernel handlers, which never preempt
+ * each other, so that no locking is required.
+ */
+#include <string.h>
+#include <sentry/ktypes.h>
+#include <sentry/managers/debug.h>
+#include <sentry/arch/asm-generic/tick.h>
+
+#define USERLOG_RING_SIZE ((uint32_t)CONFIG_DEBUG_USER_LOG_RING_SIZE)
+#define USERLOG_RING_MASK (USERLOG_RING_SIZE - 1UL)
+#define USERLOG_RATE      ((uint64_t)CONFIG_DEBUG_USER_LOG_RATE)
+#define USERLOG_BURST     ((uint32_t)CONFIG_DEBUG_USER_LOG_BURST)
+/* all tasks, including idle */
+#define USERLOG_TASKS     (CONFIG_MAX_TASKS + 1)
+
+/* "[task 0x01234567] 4294967295 log(s) dropped\n" */
+#define USERLOG_DROP_NOTICE_MAX 48U
+
+#ifndef TEST_MODE
+static inline uint64_t userlog_now(void)
+{
+    return systime_get_milliseconds();
+}
+#else
+/* host tests provide the clock */
+uint64_t userlog_now(void);
+#endif
+
+static_assert((USERLOG_RING_SIZE & USERLOG_RING_MASK) == 0, "log ring size must be a power of 2");
+static_assert(USERLOG_RING_SIZE >= (CONFIG_SVC_EXCHANGE_AREA_LEN + USERLOG_DROP_NOTICE_MAX),
+              "log ring size must hold a full length log");
+static_assert(USERLOG_BURST >= CONFIG_SVC_EXCHANGE_AREA_LEN, "log burst must allow a full length log");
+
+typedef struct userlog_task {
+    uint32_t label;    /**< task label, 0 if the entry is free */
+    uint32_t credit;   /**< remaining log bytes credit */
+    uint32_t partial;  /**< earned credit not yet refilled, in thousandths of byte */
+    uint64_t stamp;    /**< last credit refill date, in milliseconds */
+    uint32_t dropped;  /**< dropped logs since the last accepted one */
+} userlog_task_t;
+
+/**
+ * Userspace log ring. head and tail are free running indexes, the ring
+ * holds (head - tail) bytes.
+ */
+typedef struct userlog_ring {
+    uint8_t buf[USERLOG_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+} userlog_ring_t;
+
+static userlog_ring_t userlog_ring;
+static userlog_task_t userlog_tasks[USERLOG_TASKS];
+#if CONFIG_DEBUG_USER_LOG_TICK_PERIOD > 0
+static uint32_t userlog_ticks;
+#endif
+
+static userlog_task_t *userlog_get_task(uint32_t label)
+{
+    userlog_task_t *task = NULL;
+
+    for (uint8_t i = 0; i < USERLOG_TASKS; ++i) {
+        if (userlog_tasks[i].label == label) {
+            task = &userlog_tasks[i];
+            break;
+        }
+        if (userlog_tasks[i].label == 0) {
+            /* first log of the task, starting with a full credit */
+            task = &userlog_tasks[i];
+            task->label = label;
+            task->credit = USERLOG_BURST;
+            task->partial = 0;
+            task->stamp = userlog_now();
+            break;
+        }
+    }
+    return task;
+}
+
+/*
+ * The credit is earned in thousandths of byte per millisecond, the part that
+ * does not make a whole byte yet is kept for the next refill, so that frequent
+ * logs are granted the configured rate.
+ */
+static void userlog_refill(userlog_task_t *task)
+{
+    uint64_t now = userlog_now();
+    uint64_t earned = ((now - task->stamp) * USERLOG_RATE) + task->partial;
+    uint64_t credit = task->credit + (earned / 1000ULL);
+
+    task->stamp = now;
+    if (credit >= USERLOG_BURST) {
+        /* full bucket, nothing more to earn */
+        task->credit = USERLOG_BURST;
+        task->partial = 0;
+    } else {
+        task->credit = (uint32_t)credit;
+        task->partial = (uint32_t)(earned % 1000ULL);
+    }
+}
+
+static inline uint32_t userlog_ring_free(void)
+{
+    return USERLOG_RING_SIZE - (userlog_ring.head - userlog_ring.tail);
+}
+
+static void userlog_ring_put(const uint8_t *data, uint32_t len)
+{
+    uint32_t head = userlog_ring.head & USERLOG_RING_MASK;
+    uint32_t chunk = USERLOG_RING_SIZE - head;
+
+    if (chunk > len) {
+        chunk = len;
+    }
+    memcpy(&userlog_ring.buf[head], data, chunk);
+    memcpy(&userlog_ring.buf[0], &data[chunk], len - chunk);
+    userlog_ring.head += len;
+}
+
+static inline char userlog_hexchar(uint32_t nibble)
+{
+    return (char)((nibble < 10) ? ('0' + nibble) : ('a' + (nibble - 10)));
+}
+
+/**
+ * @brief forge the dropped logs notice of the given task
+ *
+ * @return the notice length
+ */
+static uint32_t userlog_drop_notice(const userlog_task_t *task, char notice[USERLOG_DROP_NOTICE_MAX])
+{
+    static const char prefix[] = "[task 0x";
+    static const char suffix[] = " log(s) dropped\n";
+    char digits[10];
+    uint32_t len = 0;
+    uint32_t ndigits = 0;
+    uint32_t dropped = task->dropped;
+
+    memcpy(&notice[len], prefix, sizeof(prefix) - 1);
+    len += sizeof(prefix) - 1;
+    for (int8_t shift = 28; shift >= 0; shift -= 4) {
+        notice[len++] = userlog_hexchar((task->label >> shift) & 0xfUL);
+    }
+    notice[len++] = ']';
+    notice[len++] = ' ';
+    do {
+        digits[ndigits++] = (char)('0' + (dropped % 10UL));
+        dropped /= 10UL;
+    } while (dropped > 0);
+    while (ndigits > 0) {
+        notice[len++] = digits[--ndigits];
+    }
+    memcpy(&notice[len], suffix, sizeof(suffix) - 1);
+    len += sizeof(suffix) - 1;
+    return len;
+}
+
+/**
+ * @brief queue a userspace log into the kernel log ring
+ *
+ * @param[in] label: emitting task label
+ * @param[in] log: log content
+ * @param[in] len: log length
+ *
+ * @return K_ERROR_BUSY if the log is dropped, K_STATUS_OKAY otherwise
+ */
+kstatus_t mgr_debug_userlog_push(uint32_t label, const uint8_t *log, size_t len)
+{
+    kstatus_t status = K_ERROR_BUSY;
+    userlog_task_t *task = userlog_get_task(label);
+    char notice[USERLOG_DROP_NOTICE_MAX];
+    uint32_t notice_len = 0;
+
+    if (unlikely(task == NULL)) {
+        /* more log emitters than tasks, should not happen */
+        goto err;
+    }
+    userlog_refill(task);
+    if (task->dropped > 0) {
+        notice_len = userlog_drop_notice(task, notice);
+    }
+    if (unlikely((len > task->credit) || ((len + notice_len) > userlog_ring_free()))) {
+        task->dropped++;
+        goto err;
+    }
+    if (notice_len > 0) {
+        /* the notice itself is not charged to the task */
+        userlog_ring_put((const uint8_t *)notice, notice_len);
+        task->dropped = 0;
+    }
+    userlog_ring_put(log, len);
+    task->credit -= len;
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+/**
+ * @brief emit at most max bytes of the log ring on the debug output
+ *
+ * @return SECURE_TRUE if the ring is empty
+ */
+secure_bool_t mgr_debug_userlog_drain(size_t max)
+{
+    uint32_t pending = userlog_ring.head - userlog_ring.tail;
+    uint32_t tail;
+    uint32_t chunk;
+
+    while ((pending > 0) && (max > 0)) {
+        tail = userlog_ring.tail & USERLOG_RING_MASK;
+        chunk = USERLOG_RING_SIZE - tail;
+        if (chunk > pending) {
+            chunk = pending;
+        }
+        if (chunk > max) {
+            chunk = max;
+        }
+        debug_rawlog(&userlog_ring.buf[tail], chunk);
+        userlog_ring.tail += chunk;
+        pending -= chunk;
+        max -= chunk;
+    }
+    return (pending == 0) ? SECURE_TRUE : SECURE_FALSE;
+}
+
+/**
+ * @brief emit a bounded amount of the log ring, periodically
+ *
+ * Called at each systick, drains at most CONFIG_DEBUG_USER_LOG_DRAIN_CHUNK
+ * bytes every CONFIG_DEBUG_USER_LOG_TICK_PERIOD ticks, so that logs are
+ * emitted even if the idle task is never scheduled.
+ */
+void mgr_debug_userlog_tick(void)
+{
+#if CONFIG_DEBUG_USER_LOG_TICK_PERIOD > 0
+    if (++userlog_ticks < CONFIG_DEBUG_USER_LOG_TICK_PERIOD) {
+        return;
+    }
+    userlog_ticks = 0;
+    mgr_debug_userlog_drain(CONFIG_DEBUG_USER_LOG_DRAIN_CHUNK);
+#endif
+}
@@ -14,6 +14,7 @@
 #include <sentry/managers/io.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/clock.h>
+#include <sentry/managers/interrupt.h>
 
 #include "devlist-dt.h"
 
@@ -141,6 +142,17 @@ kstatus_t mgr_device_init(void)
 
         /* adding taskh value (0 or effective taskh userspace handle) */
         devices_state[i].owner = owner;
+#if CONFIG_KERNEL_BASEPRI_MASKING
+        /* user devices interrupts with a DTS priority higher than the kernel one are critical */
+        if (owner != 0) {
+            for (uint8_t it = 0; it < devices[i].devinfo.num_interrupt; ++it) {
+                if (unlikely(mgr_interrupt_set_priority(devices[i].devinfo.its[it].it_num,
+                                                        devices[i].it_prio[it]) != K_STATUS_OKAY)) {
+                    panic(PANIC_CONFIGURATION_MISMATCH);
+                }
+            }
+        }
+#endif
     }
 #endif
     return status;
@@ -425,43 +437,71 @@ end:
  * XXX:
  *  How to deals with shared IRQ line ?
  *   e.g. STM32U5 ADC1 and ADC2 or  STM32f429 TIM8 (3 irq lines) respectively shared w/ TIM12/13/14)
+ *  By now, the build-time dispatch table holds the first device declaring the IRQ line.
  */
-static inline secure_bool_t dev_has_interrupt(const devinfo_t *devinfo, uint16_t IRQn)
+static inline device_state_t *device_get_state_from_interrupt(uint16_t IRQn)
 {
-    secure_bool_t res = SECURE_FALSE;
-
-    if (unlikely(devinfo->num_interrupt == 0)) {
+    device_state_t *dev = NULL;
+#if DEVICE_LIST_SIZE > 0
+    /* useless, size-limit warn, if device list is empty */
+    if (unlikely(IRQn >= NUM_IRQS)) {
         goto end;
     }
-    for (uint8_t i = 0; i < devinfo->num_interrupt; ++i) {
-        if (devinfo->its[i].it_num == IRQn) {
-            res = SECURE_TRUE;
-            goto end;
-        }
+    if (devices_irq_table[IRQn] == 0) {
+        goto end;
     }
+    dev = &devices_state[devices_irq_table[IRQn] - 1U];
 end:
-    return res;
+#endif
+    return dev;
 }
 
 kstatus_t mgr_device_get_devh_from_interrupt(uint16_t IRQn, devh_t *devh)
 {
     kstatus_t status = K_ERROR_INVPARAM;
+    device_state_t const *dev;
 
     if (unlikely(devh == NULL)) {
         goto end;
     }
-#if DEVICE_LIST_SIZE > 0
-    /* useless, size-limit warn, if device list is empty */
-    for (uint32_t i = 0; i < DEVICE_LIST_SIZE; ++i) {
-        if (dev_has_interrupt(&devices_state[i].device->devinfo, IRQn) == SECURE_TRUE) {
-            const devh_t handle = forge_devh(devices_state[i].device);
-            *devh = handle;
-            status = K_STATUS_OKAY;
-            goto end;
-        }
+    dev = device_get_state_from_interrupt(IRQn);
+    if (unlikely(dev == NULL)) {
+        status = K_ERROR_NOENT;
+        goto end;
     }
-#endif
-    status = K_ERROR_NOENT;
+    *devh = forge_devh(dev->device);
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief return both the device handle and its owner for given IRQ
+ *
+ * IRQ context variant of mgr_device_get_devh_from_interrupt() followed by
+ * mgr_device_get_owner(), using a single dispatch table lookup.
+ *
+ * @returns
+ *   K_ERROR_INVPARAM if devh or owner is NULL
+ *   K_ERROR_NOENT if no user device owns the IRQ
+ *   K_STATUS_OKAY if devh and owner are set
+ */
+kstatus_t mgr_device_get_owner_from_interrupt(uint16_t IRQn, devh_t *devh, taskh_t *owner)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    device_state_t const *dev;
+
+    if (unlikely((devh == NULL) || (owner == NULL))) {
+        goto end;
+    }
+    dev = device_get_state_from_interrupt(IRQn);
+    if (unlikely(dev == NULL)) {
+        status = K_ERROR_NOENT;
+        goto end;
+    }
+    *devh = forge_devh(dev->device);
+    *owner = dev->owner;
+    status = K_STATUS_OKAY;
 end:
     return status;
 }
@@ -469,20 +509,18 @@ end:
 kstatus_t mgr_device_get_devinfo_from_interrupt(uint16_t IRQn, const devinfo_t **devinfo)
 {
     kstatus_t status = K_ERROR_NOENT;
+    device_state_t const *dev;
+
     if (unlikely(devinfo == NULL)) {
         status = K_ERROR_INVPARAM;
         goto end;
     }
-#if DEVICE_LIST_SIZE > 0
-    /* useless, size-limit warn, if device list is empty */
-    for (uint32_t i = 0; i < DEVICE_LIST_SIZE; ++i) {
-        if (dev_has_interrupt(&devices_state[i].device->devinfo, IRQn) == SECURE_TRUE) {
-            *devinfo = &devices_state[i].device->devinfo;
-            status = K_STATUS_OKAY;
-            goto end;
-        }
+    dev = device_get_state_from_interrupt(IRQn);
+    if (unlikely(dev == NULL)) {
+        goto end;
     }
-#endif
+    *devinfo = &dev->device->devinfo;
+    status = K_STATUS_OKAY;
 end:
     return status;
 }
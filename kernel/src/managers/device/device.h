@@ -17,6 +17,7 @@ extern "C" {
 #include <inttypes.h>
 #include <sentry/ktypes.h>
 #include <sentry/managers/security.h>
+#include <uapi/device.h>
 
 typedef struct device {
     devinfo_t           devinfo;      /**< device info (info shared with userspace) */
@@ -24,6 +25,7 @@ typedef struct device {
     uint32_t            clk_id;       /**< clock identifier, as defined in dts */
     uint32_t            bus_id;       /**< bus identifier, as defined in dts */
     uint32_t            owner;        /**< label of the owner. To be fullfill by app using the outpost,owner dts flag */
+    uint8_t             it_prio[DEVICE_MAX_INTERRUPTS]; /**< interrupts priority, as defined in dts, same order as devinfo.its */
 } device_t;
 
 typedef struct kdevh {
@@ -7,13 +7,63 @@
 #include <sentry/managers/dma.h>
 #include <sentry/managers/security.h>
 #include <sentry/managers/interrupt.h>
+#include <sentry/managers/memory.h>
 #include <sentry/arch/asm-generic/panic.h>
+#include <sentry/zlib/math.h>
 #include <bsp/drivers/dma/gpdma.h>
 #include "dma-dt.h"
 #include "dma.h"
 
 static dma_stream_config_t stream_config[STREAM_LIST_SIZE];
 
+#if DMA_CHANNEL_SLOT_NUM
+/**
+ * assigned stream holding each channel slot, NULL if the channel is free.
+ * Updated at assign/unassign time, read from the DMA IRQ handler.
+ */
+static dma_stream_config_t *channel_holder[DMA_CHANNEL_SLOT_NUM];
+#endif
+
+#if CONFIG_DMA_KERNEL_MEMCPY
+/**
+ * @def maximum block length of a single kernel channel transfer, word aligned
+ */
+#define DMA_KERNEL_COPY_MAX_BLOCK 0xfffcUL
+
+/**
+ * @def maximum number of channel status polls per block, far above the duration
+ * of a DMA_KERNEL_COPY_MAX_BLOCK transfer, so that a stalled channel never
+ * hangs the kernel with interrupts masked
+ */
+#define DMA_KERNEL_COPY_POLL_MAX 0x40000UL
+
+/**
+ * kernel reserved memory-to-memory channel. Not a DTS stream, it has no handle
+ * nor owner, and permanently holds its channel slot.
+ */
+static dma_stream_config_t kernel_copy = {
+    .meta = NULL,
+    .hwcfg = {
+        .channel = CONFIG_DMA_KERNEL_MEMCPY_CHANNEL,
+        .stream = 0,
+        .controller = 0,
+        .transfer_type = GPDMA_TRANSFER_MEMORY_TO_MEMORY,
+        .interrupts = 0, /* completion is polled */
+        .priority = GPDMA_PRIORITY_LOW,
+        .transfer_mode = GPDMA_TRANSFER_MODE_INCREMENT_SRC | GPDMA_TRANSFER_MODE_INCREMENT_DEST,
+        .src_beat_len = GPDMA_BEAT_LEN_WORD,
+        .dest_beat_len = GPDMA_BEAT_LEN_WORD,
+        .linked_list = GPDMA_LINKED_LIST_NONE,
+    },
+    .handle = 0,
+    .owner = 0,
+    .state = DMA_STREAM_STATE_UNSET,
+};
+
+/** zero-fill source word, read with a fixed source address */
+static const uint32_t kernel_copy_zero = 0UL;
+#endif
+
 #ifndef CONFIG_HAS_GPDMA
 static_assert(STREAM_LIST_SIZE, "Can't have streams when no GPDMA supported!");
 #endif
@@ -52,10 +102,22 @@ kstatus_t mgr_dma_init(void)
         /*@ assert \valid(dmah); */
         /*@ assert \valid_read(stream_config[streamid].meta); */
         stream_config[streamid].handle = *dmah;
+        /* runtime copy, the channel of pooled streams is set at assign time */
+        memcpy(&stream_config[streamid].hwcfg, &stream_config[streamid].meta->config, sizeof(gpdma_stream_cfg_t));
         stream_config[streamid].state = DMA_STREAM_STATE_UNSET; /** FIXME: define status types for streams */
         stream_config[streamid].status.completed = 0;
         stream_config[streamid].status.half_reached = 0;
         stream_config[streamid].status.state = GPDMA_STATE_IDLE;
+        stream_config[streamid].lli_shm = 0;
+        stream_config[streamid].lli_offset = 0;
+        if (stream_config[streamid].meta->config.linked_list != GPDMA_LINKED_LIST_NONE) {
+            if (unlikely(mgr_mm_shm_get_handle(stream_config[streamid].meta->lli_pool,
+                                               &stream_config[streamid].lli_shm) != K_STATUS_OKAY)) {
+                /* dts lli-pool is not a SHM */
+                panic(PANIC_CONFIGURATION_MISMATCH);
+                __builtin_unreachable();
+            }
+        }
         /*
          * FIXME:
          * by now, here we have a naive probbing mechanism, meaning that
@@ -83,12 +145,15 @@ end:
 static dma_stream_config_t *mgr_dma_get_config(const dmah_t dmah)
 {
     dma_stream_config_t * cfg = NULL;
-    for (size_t streamid = 0; streamid < STREAM_LIST_SIZE; ++streamid) {
-        if (stream_config[streamid].handle == dmah) {
-            cfg = &stream_config[streamid];
-            goto end;
-        }
+    kdmah_t const *kdmah = dmah_to_kdmah(&dmah);
+
+    if (unlikely(kdmah->streamid >= STREAM_LIST_SIZE)) {
+        goto end;
+    }
+    if (unlikely(stream_config[kdmah->streamid].handle != dmah)) {
+        goto end;
     }
+    cfg = &stream_config[kdmah->streamid];
 end:
     return cfg;
 }
@@ -97,8 +162,8 @@ end:
  * @fn get static metainformation about a DMA stream identified by its handle
  *
  * The static metainformation is the overall stream definition as declared in the
- * device tree. The corresponding kernel structure (const build time forged) is
- * returned.
+ * device tree. The stream runtime copy of it is returned, so that the channel field
+ * is the one currently allocated to a pooled stream.
  *
  * @param[in] dmah: DMA stream handle for which the data is requested
  * @param[out] infos: DMA stream info address to be updated
@@ -113,7 +178,7 @@ kstatus_t mgr_dma_get_info(const dmah_t dmah, gpdma_stream_cfg_t const ** infos)
     }
     for (size_t streamid = 0; streamid < STREAM_LIST_SIZE; ++streamid) {
         if (stream_config[streamid].handle == dmah) {
-            *infos = &stream_config[streamid].meta->config;
+            *infos = &stream_config[streamid].hwcfg;
             status = K_STATUS_OKAY;
             goto end;
         }
@@ -201,7 +266,7 @@ kstatus_t mgr_dma_treat_chan_event(const dmah_t dmah)
     }
 
     /* an interrupt has risen, get back stream HW status from GPDMA upper API */
-    if (unlikely(gpdma_channel_get_status(&cfg->meta->config, &cfg->status) != K_STATUS_OKAY)) {
+    if (unlikely(gpdma_channel_get_status(&cfg->hwcfg, &cfg->status) != K_STATUS_OKAY)) {
         goto end;
     }
     /* react on interrupt: update state automaton */
@@ -211,8 +276,21 @@ kstatus_t mgr_dma_treat_chan_event(const dmah_t dmah)
     if (cfg->status.state == GPDMA_STATE_SUSPENDED) {
         cfg->state = DMA_STREAM_STATE_SUSPENDED;
     }
+    /*
+     * linked-list streams never get idle, each block end (and half block) is
+     * delivered as a transfer event, telling the task which buffer is ready
+     */
+    if (cfg->meta->config.linked_list != GPDMA_LINKED_LIST_NONE &&
+        cfg->status.state != GPDMA_STATE_TRANSMISSION_FAILURE &&
+        cfg->status.state != GPDMA_STATE_CONFIGURATION_FAILURE) {
+        if (cfg->status.completed) {
+            cfg->status.state = GPDMA_STATE_TRANSFER_COMPLETE;
+        } else if (cfg->status.half_reached) {
+            cfg->status.state = GPDMA_STATE_HALF_TRANSFER;
+        }
+    }
     /* clearing status no that IT-related status has been stored in the stream status field */
-    gpdma_channel_clear_status(&cfg->meta->config);
+    gpdma_channel_clear_status(&cfg->hwcfg);
     status = K_STATUS_OKAY;
 end:
     return status;
@@ -230,7 +308,11 @@ kstatus_t mgr_dma_get_status(dmah_t d, gpdma_chan_state_t *dma_status)
     if (stream_config[kdmah->streamid].handle != d) {
         goto end;
     }
-    memcpy(dma_status, &stream_config[kdmah->streamid].state, sizeof(gpdma_chan_state_t));
+    if (stream_config[kdmah->streamid].meta->config.linked_list != GPDMA_LINKED_LIST_NONE) {
+        *dma_status = stream_config[kdmah->streamid].status.state;
+    } else {
+        memcpy(dma_status, &stream_config[kdmah->streamid].state, sizeof(gpdma_chan_state_t));
+    }
     status = K_STATUS_OKAY;
 end:
     return status;
@@ -244,46 +326,158 @@ kstatus_t mgr_dma_autotest(void)
 }
 #endif
 
+/**
+ * @brief check if the given IRQ is a GPDMA channel one, using the build-time dispatch table
+ */
+bool mgr_dma_is_irq_owned(uint16_t IRQn)
+{
+    size_t slot;
+    return (dma_irq_get_slot(IRQn, &slot) == K_STATUS_OKAY);
+}
+
 /**
  * @brief given an IRQ number, return the started stream's handle associated to it
  *
- * This concept requires that each DMA controler's channel is linked to a single handle at a given time
+ * The IRQn is resolved to its channel slot using the build-time dispatch table, and
+ * the channel to the assigned stream holding it, as a channel is held by a single
+ * assigned stream at a time. The channel of a pooled stream is only known at assign time.
  *
  * @param[in] IRQn: IRQ number received from the core (nvic, etc.) IRQ controller
  * @param[out] dmah: DMA handle that is associated to that IRQ
  *
  * @return
  *   K_ERROR_INVPARAM: handle is not a valid pointer
+ *   K_ERROR_NOENT: the IRQ is not a GPDMA one, or its channel is not held by any stream
  *   K_STATUS_OKAY: stream assignation done with success
  */
 kstatus_t mgr_dma_get_dmah_from_interrupt(const uint16_t IRQn, dmah_t *dmah)
 {
     kstatus_t status = K_ERROR_INVPARAM;
-    uint16_t stream_irqn = 0;
-    uint16_t stream;
-    gpdma_stream_cfg_t const *cfg = NULL;
+    size_t slot;
 
     if (unlikely(dmah == NULL)) {
         goto end;
     }
-    /* 1. get back dma {chan,ctrl} couple from IRQn */
-    for (stream = 0; stream < STREAM_LIST_SIZE; ++stream) {
-        cfg = &stream_config[stream].meta->config;
-        /* stream hold the ctrl/chan couple from which we can deduce the IRQn */
-        /*@ assert \valid_read(cfg); */
-        if (unlikely(gpdma_get_interrupt(cfg, &stream_irqn) != K_STATUS_OKAY)) {
-            panic(PANIC_CONFIGURATION_MISMATCH);
-            __builtin_unreachable();
+    if (unlikely((status = dma_irq_get_slot(IRQn, &slot)) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    status = K_ERROR_NOENT;
+#if DMA_CHANNEL_SLOT_NUM
+    if (unlikely(channel_holder[slot] == NULL)) {
+        goto end;
+    }
+    *dmah = channel_holder[slot]->handle;
+    status = K_STATUS_OKAY;
+#endif
+end:
+    return status;
+}
+
+/**
+ * @brief allocate and build the linked-list table of a linked-list stream
+ *
+ * The table is allocated, on behalf of the stream owner, in the stream
+ * lli-pool SHM, which is a non-mappable DMA pool. Such a pool is neither
+ * mapped nor accessed by kernel SHM services on behalf of a task (see
+ * mgr_mm_shm_check_access()), so that the table can't be forged by any task. The table is written by the kernel and cleaned from the
+ * data cache before the channel can load it.
+ */
+static kstatus_t mgr_dma_stream_link(dma_stream_config_t *cfg)
+{
+    kstatus_t status;
+    size_t base;
+
+    status = mgr_mm_shm_dma_alloc(cfg->lli_shm, cfg->owner, GPDMA_LLI_TABLE_MAX_LEN, &cfg->lli_offset);
+    if (unlikely(status != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (unlikely((status = mgr_mm_shm_get_baseaddr(cfg->lli_shm, &base)) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    base += cfg->lli_offset;
+    if (unlikely((status = gpdma_channel_link(&cfg->hwcfg, base)) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    mgr_mm_dcache_clean(base, GPDMA_LLI_TABLE_MAX_LEN);
+    goto end;
+err:
+    mgr_mm_shm_dma_free(cfg->lli_shm, cfg->owner, cfg->lli_offset);
+end:
+    return status;
+}
+
+/**
+ * @brief check that no other assigned stream holds the given controller channel
+ */
+static inline bool mgr_dma_channel_is_free(dma_stream_config_t const *cfg, uint16_t channel)
+{
+    bool is_free = false;
+    size_t slot;
+
+    if (unlikely(dma_channel_get_slot(cfg->hwcfg.controller, channel, &slot) != K_STATUS_OKAY)) {
+        /* not an existing channel */
+        goto end;
+    }
+#if DMA_CHANNEL_SLOT_NUM
+    is_free = (channel_holder[slot] == NULL) || (channel_holder[slot] == cfg);
+#endif
+end:
+    return is_free;
+}
+
+/**
+ * @brief set (or release, if holder is NULL) the holder of the stream channel
+ */
+static inline void mgr_dma_channel_set_holder(dma_stream_config_t const *cfg, dma_stream_config_t *holder)
+{
+    size_t slot;
+
+    /* the stream channel has been validated at assign time */
+    if (unlikely(dma_channel_get_slot(cfg->hwcfg.controller, cfg->hwcfg.channel, &slot) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+        __builtin_unreachable();
+    }
+#if DMA_CHANNEL_SLOT_NUM
+    channel_holder[slot] = holder;
+#endif
+}
+
+/**
+ * @brief allocate a channel to the stream and configure it
+ *
+ * The DTS channel is tried first. Pooled streams then fall back to the first free
+ * channel of their pool on which the driver accepts the stream configuration.
+ *
+ * @return
+ *   K_ERROR_BUSY: all the candidate channels are held by other assigned streams
+ *   K_STATUS_OKAY: hwcfg channel is allocated and configured
+ *   any other value: driver error of the last tried channel
+ */
+static kstatus_t mgr_dma_stream_configure(dma_stream_config_t *cfg)
+{
+    kstatus_t status = K_ERROR_BUSY;
+    uint16_t const dts_channel = cfg->meta->config.channel;
+    uint32_t pool = cfg->meta->channel_pool;
+
+    if (mgr_dma_channel_is_free(cfg, dts_channel)) {
+        cfg->hwcfg.channel = dts_channel;
+        if ((status = gpdma_channel_configure(&cfg->hwcfg)) == K_STATUS_OKAY) {
+            goto end;
         }
-        if (stream_irqn == IRQn) {
-            *dmah = stream_config[stream].handle;
-            status = K_STATUS_OKAY;
+    }
+    for (uint16_t channel = 0; pool != 0; ++channel, pool >>= 1) {
+        if (((pool & 0x1UL) == 0) || (channel == dts_channel)) {
+            continue;
+        }
+        if (!mgr_dma_channel_is_free(cfg, channel)) {
+            continue;
+        }
+        cfg->hwcfg.channel = channel;
+        if ((status = gpdma_channel_configure(&cfg->hwcfg)) == K_STATUS_OKAY) {
             goto end;
         }
     }
-    /* not found, leaving with error */
-    status = K_ERROR_NOENT;
-    goto end;
+    cfg->hwcfg.channel = dts_channel;
 end:
     return status;
 }
@@ -295,11 +489,15 @@ end:
  * hardware IP configured in DMA mode in case of DEVICE_TO_MEMORY mode, or by a call to the DMA
  * stream start syscall.
  *
+ * Streams declared with the `channel-pool` DTS property are not bound to their DTS
+ * channel but get any free channel of their pool, which is released at unassign time.
+ *
  * @param[in] dmah: DMA handle that is boot-time associated to the stream
  *
  * @return
  *   K_ERROR_INVPARAM: handle is not found
  *   K_ERROR_BADSTATE: the stream is already assigned/started
+ *   K_ERROR_BUSY: no channel is free, all are held by other assigned streams
  *   K_STATUS_OKAY: stream assignation done with success
  */
 kstatus_t mgr_dma_stream_assign(const dmah_t dmah)
@@ -316,11 +514,17 @@ kstatus_t mgr_dma_stream_assign(const dmah_t dmah)
         status = K_ERROR_BADSTATE;
         goto end;
     }
-    if (unlikely((status = gpdma_channel_configure(&cfg->meta->config)) != K_STATUS_OKAY)) {
+    if (unlikely((status = mgr_dma_stream_configure(cfg)) != K_STATUS_OKAY)) {
         goto end;
     }
+    if (cfg->meta->config.linked_list != GPDMA_LINKED_LIST_NONE) {
+        if (unlikely((status = mgr_dma_stream_link(cfg)) != K_STATUS_OKAY)) {
+            goto end;
+        }
+    }
     cfg->state = DMA_STREAM_STATE_ASSIGNED;
-    gpdma_get_interrupt(&cfg->meta->config, &IRQn);
+    mgr_dma_channel_set_holder(cfg, cfg);
+    gpdma_get_interrupt(&cfg->hwcfg, &IRQn);
     mgr_interrupt_enable_irq(IRQn);
 end:
     return status;
@@ -330,6 +534,7 @@ end:
  * @brief unassign a DMA stream configuration associated to given handle from the DMA controller channel
  *
  * The DMA stream is unassigned, the channel is reconfigured to its reset time value.
+ * The channel is released, its interrupt line is disabled until the next assignment.
  *
  * @param[in] dmah: DMA handle that is boot-time associated to the stream
  *
@@ -342,6 +547,7 @@ kstatus_t mgr_dma_stream_unassign(const dmah_t dmah)
 {
     kstatus_t status = K_ERROR_INVPARAM;
     dma_stream_config_t * const cfg = mgr_dma_get_config(dmah);
+    uint16_t IRQn;
 
     if (unlikely(cfg == NULL)) {
         goto end;
@@ -356,12 +562,20 @@ kstatus_t mgr_dma_stream_unassign(const dmah_t dmah)
     }
     /* unassigning a suspended stream requires to reset first */
     if (cfg->state == DMA_STREAM_STATE_SUSPENDED) {
-        if (unlikely(gpdma_channel_reset(&cfg->meta->config) != K_STATUS_OKAY)) {
+        if (unlikely(gpdma_channel_reset(&cfg->hwcfg) != K_STATUS_OKAY)) {
             status = K_ERROR_BADSTATE;
             goto end;
         }
     }
+    if (cfg->meta->config.linked_list != GPDMA_LINKED_LIST_NONE) {
+        /* the channel is reset, its linked-list table is no more used */
+        mgr_mm_shm_dma_free(cfg->lli_shm, cfg->owner, cfg->lli_offset);
+    }
+    gpdma_get_interrupt(&cfg->hwcfg, &IRQn);
+    mgr_interrupt_disable_irq(IRQn);
+    mgr_dma_channel_set_holder(cfg, NULL);
     cfg->state = DMA_STREAM_STATE_UNSET;
+    cfg->hwcfg.channel = cfg->meta->config.channel;
     status = K_STATUS_OKAY;
 end:
     return status;
@@ -417,7 +631,7 @@ kstatus_t mgr_dma_stream_start(const dmah_t dmah)
         status = K_ERROR_BADSTATE;
         goto end;
     }
-    status = gpdma_channel_enable(&cfg->meta->config);
+    status = gpdma_channel_enable(&cfg->hwcfg);
     cfg->state = DMA_STREAM_STATE_STARTED;
     /* returns the status code returned by driver start API*/
 end:
@@ -452,7 +666,7 @@ kstatus_t mgr_dma_stream_suspend(const dmah_t dmah)
         status = K_ERROR_BADSTATE;
         goto end;
     }
-    status = gpdma_channel_suspend(&cfg->meta->config);
+    status = gpdma_channel_suspend(&cfg->hwcfg);
     if (likely(status == K_STATUS_OKAY)) {
         cfg->state = DMA_STREAM_STATE_SUSPENDED;
     }
@@ -488,7 +702,7 @@ kstatus_t mgr_dma_stream_resume(const dmah_t dmah)
         status = K_ERROR_BADSTATE;
         goto end;
     }
-    status = gpdma_channel_resume(&cfg->meta->config);
+    status = gpdma_channel_resume(&cfg->hwcfg);
     if (likely(status == K_STATUS_OKAY)) {
         cfg->state = DMA_STREAM_STATE_STARTED;
     }
@@ -496,3 +710,191 @@ kstatus_t mgr_dma_stream_resume(const dmah_t dmah)
 end:
     return status;
 }
+
+#if CONFIG_DMA_KERNEL_MEMCPY
+/**
+ * @brief reserve the kernel memory copy channel
+ *
+ * The channel is removed from the channel pool of any stream, and DTS streams
+ * statically bound to it are a configuration mismatch.
+ *
+ * Called at boot time before the task manager init, so that tasks .got, .data
+ * and .bss are initialized through the channel. Later controllers probes, at
+ * DMA manager init, keep the kernel channel privilege.
+ */
+kstatus_t mgr_dma_kernel_copy_init(void)
+{
+    kstatus_t status = K_ERROR_BADSTATE;
+    size_t slot;
+
+    if (unlikely(dma_channel_get_slot(kernel_copy.hwcfg.controller, kernel_copy.hwcfg.channel, &slot) != K_STATUS_OKAY)) {
+        panic(PANIC_CONFIGURATION_MISMATCH);
+        __builtin_unreachable();
+    }
+    for (size_t streamid = 0; streamid < STREAM_LIST_SIZE; ++streamid) {
+        dma_meta_t const *meta;
+        /* stream_config[] may not be initialized yet, using DTS metadata */
+        if (unlikely(dma_stream_get_meta(streamid, &meta) != K_STATUS_OKAY)) {
+            panic(PANIC_CONFIGURATION_MISMATCH);
+            __builtin_unreachable();
+        }
+        gpdma_stream_cfg_t const *config = &meta->config;
+        if ((config->controller == kernel_copy.hwcfg.controller) &&
+            (config->channel == kernel_copy.hwcfg.channel)) {
+            panic(PANIC_CONFIGURATION_MISMATCH);
+            __builtin_unreachable();
+        }
+    }
+    if (unlikely(gpdma_probe(kernel_copy.hwcfg.controller) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (unlikely(gpdma_channel_set_privileged(&kernel_copy.hwcfg) != K_STATUS_OKAY)) {
+        goto end;
+    }
+#if DMA_CHANNEL_SLOT_NUM
+    channel_holder[slot] = &kernel_copy;
+#endif
+    kernel_copy.state = DMA_STREAM_STATE_ASSIGNED;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief poll the kernel memory copy channel until the given state or an error
+ *
+ * @return K_ERROR_BUSY if the channel is still running after
+ *  DMA_KERNEL_COPY_POLL_MAX polls
+ */
+static inline kstatus_t mgr_dma_kernel_poll(gpdma_chan_status_t *chan_status, gpdma_chan_state_t state)
+{
+    return gpdma_channel_poll(&kernel_copy.hwcfg, state, DMA_KERNEL_COPY_POLL_MAX, chan_status);
+}
+
+/**
+ * @brief stop a stalled transfer on the kernel memory copy channel
+ *
+ * The channel is suspended then reset. If it can't be stopped, it is left
+ * unassigned, so that no more kernel copies are submitted to it.
+ */
+static void mgr_dma_kernel_abort(void)
+{
+    gpdma_chan_status_t chan_status;
+
+    kernel_copy.state = DMA_STREAM_STATE_UNSET;
+    gpdma_channel_suspend(&kernel_copy.hwcfg);
+    chan_status.completed = 0;
+    chan_status.state = GPDMA_STATE_RUNNING;
+    if (unlikely(mgr_dma_kernel_poll(&chan_status, GPDMA_STATE_SUSPENDED) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    /* the transfer may also have completed or failed meanwhile, no reset needed */
+    if ((chan_status.state == GPDMA_STATE_SUSPENDED) &&
+        unlikely(gpdma_channel_reset(&kernel_copy.hwcfg) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    gpdma_channel_clear_status(&kernel_copy.hwcfg);
+    kernel_copy.state = DMA_STREAM_STATE_ASSIGNED;
+end:
+    return;
+}
+
+/**
+ * @brief synchronous transfer on the kernel memory copy channel
+ *
+ * The transfer is split in blocks of at most DMA_KERNEL_COPY_MAX_BLOCK bytes,
+ * the completion of each block being polled, as the kernel is not preemptible.
+ * The polling is bounded, a stalled transfer being aborted.
+ * The DMA does not go through the MPU, the caller is responsible for the
+ * validity of both ranges.
+ */
+static kstatus_t mgr_dma_kernel_transfer(size_t dest, size_t src, size_t len, uint8_t mode)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    gpdma_stream_cfg_t * const cfg = &kernel_copy.hwcfg;
+    gpdma_chan_status_t chan_status;
+
+    if (unlikely(kernel_copy.state != DMA_STREAM_STATE_ASSIGNED)) {
+        /* not yet initialized, or already in use */
+        status = K_ERROR_NOTREADY;
+        goto end;
+    }
+    /* word beats only */
+    if (unlikely(((dest | src | len) & 0x3UL) != 0)) {
+        goto end;
+    }
+    /* no wrap-around */
+    if (unlikely(((dest + len) < dest) || ((src + len) < src))) {
+        goto end;
+    }
+    kernel_copy.state = DMA_STREAM_STATE_STARTED;
+    if (mode & GPDMA_TRANSFER_MODE_INCREMENT_SRC) {
+        mgr_mm_dcache_clean(src, len);
+    }
+    /* dirty lines must not be evicted over the DMA written data */
+    mgr_mm_dcache_clean(dest, len);
+    cfg->transfer_mode = mode;
+    while (len > 0) {
+        cfg->source = src;
+        cfg->dest = dest;
+        cfg->transfer_len = MIN(len, DMA_KERNEL_COPY_MAX_BLOCK);
+        if (unlikely((status = gpdma_channel_configure(cfg)) != K_STATUS_OKAY)) {
+            goto release;
+        }
+        gpdma_channel_enable(cfg);
+        chan_status.completed = 0;
+        chan_status.state = GPDMA_STATE_RUNNING;
+        if (unlikely(mgr_dma_kernel_poll(&chan_status, GPDMA_STATE_TRANSFER_COMPLETE) != K_STATUS_OKAY)) {
+            mgr_dma_kernel_abort();
+            status = K_ERROR_BUSY;
+            goto end;
+        }
+        gpdma_channel_clear_status(cfg);
+        if (unlikely(chan_status.completed == 0)) {
+            status = K_ERROR_BADSTATE;
+            goto release;
+        }
+        if (mode & GPDMA_TRANSFER_MODE_INCREMENT_SRC) {
+            src += cfg->transfer_len;
+        }
+        mgr_mm_dcache_invalidate(dest, cfg->transfer_len);
+        dest += cfg->transfer_len;
+        len -= cfg->transfer_len;
+    }
+    status = K_STATUS_OKAY;
+release:
+    kernel_copy.state = DMA_STREAM_STATE_ASSIGNED;
+end:
+    return status;
+}
+
+/**
+ * @brief copy len bytes from src to dest using the kernel memory copy channel
+ *
+ * @return
+ *   K_ERROR_NOTREADY: the DMA manager is not yet initialized, or the channel
+ *     has been disabled after a stalled transfer
+ *   K_ERROR_INVPARAM: unaligned address or length, or wrapping range
+ *   K_ERROR_BADSTATE: the DMA transfer failed
+ *   K_ERROR_BUSY: the DMA transfer has not completed in time and was aborted
+ *   K_STATUS_OKAY: dest is a copy of src
+ */
+kstatus_t mgr_dma_kernel_memcpy(size_t dest, size_t src, size_t len)
+{
+    return mgr_dma_kernel_transfer(dest, src, len,
+                                   GPDMA_TRANSFER_MODE_INCREMENT_SRC | GPDMA_TRANSFER_MODE_INCREMENT_DEST);
+}
+
+/**
+ * @brief zero-fill len bytes at dest using the kernel memory copy channel
+ *
+ * The source address is a single zero word, not incremented.
+ *
+ * @return see mgr_dma_kernel_memcpy()
+ */
+kstatus_t mgr_dma_kernel_memzero(size_t dest, size_t len)
+{
+    return mgr_dma_kernel_transfer(dest, (size_t)&kernel_copy_zero, len,
+                                   GPDMA_TRANSFER_MODE_INCREMENT_DEST);
+}
+#endif
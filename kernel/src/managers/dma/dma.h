@@ -28,10 +28,13 @@ typedef enum dma_stream_state {
  */
 typedef struct dma_stream_config {
     dma_meta_t const         * meta;   /**< Hardware configuration of the stream */
+    gpdma_stream_cfg_t         hwcfg;  /**< runtime hardware configuration, channel is pool-allocated for pooled streams */
     dmah_t                     handle; /**< associated DMA handle (opaque format) */
     taskh_t                    owner;  /**< stream owner task handle */
     dma_stream_state_t         state;  /**< DMA stream state (configuration relative state) */
     gpdma_chan_status_t        status;  /**< DMA channel status, stream-relative dynamic */
+    shmh_t                     lli_shm; /**< linked-list table DMA pool, linked-list streams only */
+    size_t                     lli_offset; /**< linked-list table offset in lli_shm, when assigned */
 } dma_stream_config_t;
 
 
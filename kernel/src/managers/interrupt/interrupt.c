@@ -1,12 +1,14 @@
 // SPDX-FileCopyrightText: 2023 Ledger SAS
 // SPDX-License-Identifier: Apache-2.0
 
+#include <string.h>
 #include <uapi/handle.h>
 #include <sentry/managers/clock.h>
 #include <sentry/ktypes.h>
 #include <sentry/arch/asm-generic/interrupt.h>
 #include <sentry/arch/asm-generic/thread.h>
 #include <sentry/arch/asm-generic/panic.h>
+#include <sentry/managers/debug.h>
 #include <sentry/managers/device.h>
 #include <sentry/managers/dma.h>
 #include <sentry/managers/task.h>
@@ -18,6 +20,58 @@
 #include <bsp/drivers/flash/flash.h>
 #include <bsp/drivers/dma/gpdma.h>
 
+#if CONFIG_KERNEL_BASEPRI_MASKING
+#define INT_BITMAP_LEN ((NUM_IRQS + 31UL) / 32UL)
+
+/**
+ * critical interrupts bitmap, set at init time only, read by the kernel bypass entry
+ */
+static uint32_t int_critical[INT_BITMAP_LEN];
+
+/**
+ * critical interrupts received and not yet delivered. Written by the kernel
+ * bypass entry, which may preempt the kernel, and consumed at PendSV time.
+ * Only atomic accesses are allowed.
+ */
+static uint32_t int_critical_pending[INT_BITMAP_LEN];
+#endif
+
+#if CONFIG_SCHED_DEFERRED_SWITCH
+/**
+ * @brief request a deferred election if the woken-up owner must preempt the current job
+ *
+ * Only marks the reschedule (PendSV), the election itself is executed once, at
+ * PendSV time, whatever the number of wake-ups received in the meantime.
+ * The current job is preempted only if it is the idle task or if the woken-up
+ * owner has a strictly higher priority.
+ */
+static inline void int_may_request_preemption(taskh_t owner)
+{
+    taskh_t current = sched_get_current();
+    const task_meta_t *owner_meta;
+    const task_meta_t *current_meta;
+
+    if (unlikely(owner == current)) {
+        goto end;
+    }
+    if (mgr_task_is_idletask(current) == SECURE_TRUE) {
+        sched_request_preempt();
+        goto end;
+    }
+    if (unlikely(mgr_task_get_metadata(owner, &owner_meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    if (unlikely(mgr_task_get_metadata(current, &current_meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    if (owner_meta->priority > current_meta->priority) {
+        sched_request_preempt();
+    }
+end:
+    return;
+}
+#endif
+
 /**
  * @brief push IRQn to owner's input queue, and schedule it if all hypothesis are valid
  *
@@ -47,6 +101,9 @@ static inline void int_push_and_schedule(taskh_t owner, int IRQn)
         mgr_task_set_sysreturn(owner, STATUS_INTR);
         mgr_task_set_state(owner, JOB_STATE_READY);
         sched_schedule(owner);
+#if CONFIG_SCHED_DEFERRED_SWITCH
+        int_may_request_preemption(owner);
+#endif
     }
 }
 
@@ -55,23 +112,20 @@ static inline stack_frame_t *devisr_handler(stack_frame_t *frame, int IRQn)
     devh_t dev;
     taskh_t owner;
 
-    /* get the device owning the interrupt */
-    if (unlikely(mgr_device_get_devh_from_interrupt(IRQn, &dev) != K_STATUS_OKAY)) {
+    /* get the device owning the interrupt, and its owner, from the IRQ dispatch table */
+    if (unlikely(mgr_device_get_owner_from_interrupt(IRQn, &dev, &owner) != K_STATUS_OKAY)) {
         /* interrupt with no known device ???? */
         panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
     }
-    /* get the task owning the device */
-    if (unlikely(mgr_device_get_owner(dev, &owner) != K_STATUS_OKAY)) {
-        /* user interrupt with no owning task ???? */
-        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
-    }
     /* masking interrupt, let the userspace unmask at its handler level */
     interrupt_disable_irq(IRQn);
     int_push_and_schedule(owner, IRQn);
 
     /** NOTE: we do not elect here, meaning that if the owner is not the current task, it
      * it do not synchronously preempt the task, but instead let the quantum management
-     * execute the election. This generates potential latency
+     * execute the election. This generates potential latency.
+     * With CONFIG_SCHED_DEFERRED_SWITCH, a higher priority owner preempts the current
+     * job at PendSV time instead.
      */
     return frame;
 }
@@ -105,6 +159,9 @@ static inline void dma_push_and_schedule(taskh_t owner, dmah_t handle, gpdma_cha
         mgr_task_set_sysreturn(owner, STATUS_INTR);
         mgr_task_set_state(owner, JOB_STATE_READY);
         sched_schedule(owner);
+#if CONFIG_SCHED_DEFERRED_SWITCH
+        int_may_request_preemption(owner);
+#endif
     }
 }
 
@@ -153,29 +210,176 @@ static inline stack_frame_t *dmaisr_handler(stack_frame_t *frame, int IRQn)
 }
 #endif
 
+#if CONFIG_DEBUG_IRQ_PROBE
+/**
+ * @brief latency probe interrupt handler
+ *
+ * The probe interrupt is kernel owned, it is acknowledged here and delivered
+ * to the task that armed the probe. The NVIC line is not masked.
+ */
+static inline stack_frame_t *probeisr_handler(stack_frame_t *frame, int IRQn)
+{
+    taskh_t owner;
+
+    if (mgr_debug_irqprobe_handler((uint32_t)IRQn, &owner) == K_STATUS_OKAY) {
+        int_push_and_schedule(owner, IRQn);
+    }
+    return frame;
+}
+#endif
+
 stack_frame_t *userisr_handler(stack_frame_t *frame, int IRQn)
 {
+#if CONFIG_DEBUG_USART_ASYNC
+    /* kernel owned asynchronous log output, never delivered to userspace */
+    if (unlikely(mgr_debug_is_log_irq((uint32_t)IRQn) == SECURE_TRUE)) {
+        mgr_debug_log_irq_handler();
+        goto end;
+    }
+#endif
+#if CONFIG_DEBUG_IRQ_PROBE
+    if (unlikely(mgr_debug_irqprobe_is_probe((uint32_t)IRQn) == SECURE_TRUE)) {
+        frame = probeisr_handler(frame, IRQn);
+        goto end;
+    }
+#endif
     /* differentiate DMA IRQ from devices IRQ
      * DMA IRQn are associated to dma handles (bijection with a dts stream),
      * while user devices IRQn are associated to dev handle (bijection with a device)
      */
 #if CONFIG_HAS_GPDMA
-    if (gpdma_irq_is_dma_owned(IRQn)) {
+    if (mgr_dma_is_irq_owned(IRQn)) {
         frame = dmaisr_handler(frame, IRQn);
         goto end;
     }
 #endif
     frame = devisr_handler(frame, IRQn);
-#if CONFIG_HAS_GPDMA
+#if CONFIG_HAS_GPDMA || CONFIG_DEBUG_IRQ_PROBE || CONFIG_DEBUG_USART_ASYNC
 end:
 #endif
     return frame;
 }
 
+#if CONFIG_KERNEL_BASEPRI_MASKING
+/**
+ * @brief critical interrupts kernel bypass
+ *
+ * Executed at exception entry, before the kernel context save, and thus not
+ * masked by the kernel BASEPRI level. Neither the task context nor the
+ * scheduler are touched here: the interrupt line is masked, the interrupt is
+ * marked as pending and the delivery is deferred to PendSV, which is executed
+ * once the kernel work (if any) is terminated.
+ *
+ * @param[in] ipsr: IPSR register value at exception entry
+ *
+ * @return 1 if the interrupt is a critical one and has been handled, 0 otherwise
+ */
+uint32_t critisr_handler(uint32_t ipsr)
+{
+    uint32_t handled = 0UL;
+    uint32_t IRQn = ipsr & IPSR_ISR_Msk;
+
+    /* core exceptions are never critical */
+    if (IRQn < 16UL) {
+        goto end;
+    }
+    IRQn -= 16UL;
+    if (unlikely(IRQn >= NUM_IRQS)) {
+        goto end;
+    }
+    if ((int_critical[IRQn / 32UL] & (1UL << (IRQn % 32UL))) == 0UL) {
+        goto end;
+    }
+    /* masking interrupt, let the userspace unmask at its handler level */
+    interrupt_disable_irq(IRQn);
+    __atomic_fetch_or(&int_critical_pending[IRQn / 32UL], 1UL << (IRQn % 32UL), __ATOMIC_RELAXED);
+    interrupt_request_context_switch();
+    handled = 1UL;
+end:
+    return handled;
+}
+
+/**
+ * @brief deliver pending critical interrupts to their owners
+ *
+ * Called at PendSV time, before the election, so that owners woken-up by
+ * a critical interrupt are considered by the scheduler.
+ *
+ * @return the number of delivered interrupts
+ */
+uint32_t mgr_interrupt_critical_flush(void)
+{
+    uint32_t pending;
+    uint32_t bit;
+    uint32_t delivered = 0UL;
+
+    for (uint32_t i = 0; i < INT_BITMAP_LEN; ++i) {
+        pending = __atomic_exchange_n(&int_critical_pending[i], 0UL, __ATOMIC_RELAXED);
+        while (pending != 0UL) {
+            bit = (uint32_t)__builtin_ctz(pending);
+            pending &= pending - 1UL;
+            /* devisr_handler() never updates the frame */
+            devisr_handler(NULL, (int)((i * 32UL) + bit));
+            delivered++;
+        }
+    }
+    return delivered;
+}
+
+/**
+ * @brief set the priority of a user interrupt line
+ *
+ * Interrupts with a priority higher (numerically lower) than the kernel one
+ * are declared critical and are delivered through the kernel bypass entry.
+ * Other interrupts stay at the kernel priority level, so that they are masked
+ * during kernel sections.
+ *
+ * @param[in] irq IRQ number
+ * @param[in] priority priority, as defined in the DTS
+ *
+ * @return K_ERROR_INVPARAM if irq is invalid on the platform, or K_STATUS_OKAY
+ */
+kstatus_t mgr_interrupt_set_priority(uint32_t irq, uint32_t priority)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+
+    if (unlikely(irq >= NUM_IRQS)) {
+        goto err;
+    }
+    if (priority >= INTERRUPT_KERNEL_PRIORITY) {
+        /* not a critical one, nothing to do */
+        status = K_STATUS_OKAY;
+        goto err;
+    }
+    status = interrupt_set_priority((int32_t)irq, priority);
+    if (unlikely(status != K_STATUS_OKAY)) {
+        goto err;
+    }
+    /* only bypassed once its priority is effectively above the kernel level */
+    int_critical[irq / 32UL] |= (1UL << (irq % 32UL));
+err:
+    return status;
+}
+#endif
+
 kstatus_t mgr_interrupt_init(void)
 {
     /** FIXME: implement init part of interrupt manager */
     interrupt_init(); /** still needed again ? */
+#if CONFIG_KERNEL_BASEPRI_MASKING
+    /*
+     * all kernel handled exceptions and interrupts share the same priority level,
+     * so that they never preempt each other, and are masked by the kernel BASEPRI
+     * value. Critical interrupts are set later, at device manager init time.
+     */
+    memset(int_critical, 0x0, sizeof(int_critical));
+    memset(int_critical_pending, 0x0, sizeof(int_critical_pending));
+    for (uint32_t irq = 0; irq < NUM_IRQS; ++irq) {
+        interrupt_set_priority((int32_t)irq, INTERRUPT_KERNEL_PRIORITY);
+    }
+    interrupt_set_priority(SVC_IRQ, INTERRUPT_KERNEL_PRIORITY);
+    interrupt_set_priority(SYSTICK_IRQ, INTERRUPT_KERNEL_PRIORITY);
+#endif
     return K_STATUS_OKAY;
 }
 
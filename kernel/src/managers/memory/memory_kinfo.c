@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file kernel information page (CONFIG_MM_KINFO_PAGE)
+ *
+ * The page is a kernel .bss object, mapped read-only in each task layout
+ * (see mgr_mm_forge_ressource()), over the kernel data region. Its layout is
+ * shared with userspace through uapi/kinfo.h.
+ *
+ * The time fields are written from the systick handler under a sequence
+ * counter. Kernel handlers never preempt each other, so that there is a single
+ * writer. The task directory is written at task manager init time, before
+ * userspace is spawned, and then never changes.
+ */
+#include <sentry/ktypes.h>
+#include <sentry/managers/memory.h>
+#include <sentry/managers/clock.h>
+#include <sentry/arch/asm-generic/membarriers.h>
+#include <uapi/kinfo.h>
+
+/* the page is mapped as a single MPU region, aligned on its size */
+typedef union kinfo_area {
+    kinfo_page_t page;
+    uint8_t raw[KINFO_PAGE_SIZE];
+} kinfo_area_t;
+
+static_assert(sizeof(kinfo_area_t) == KINFO_PAGE_SIZE, "kinfo area must be a full MPU region");
+
+#ifndef __FRAMAC__
+_Alignas(KINFO_PAGE_SIZE)
+#endif
+static kinfo_area_t kinfo;
+
+/**
+ * @brief set the page boot time constant fields
+ *
+ * The clock manager must be initialized first, for cycle calibration.
+ */
+void mgr_mm_kinfo_init(void)
+{
+    kinfo.page.cycles_per_usec = mgr_clock_get_cycle_per_usec();
+    kinfo.page.systick_hz = CONFIG_SYSTICK_HZ;
+    kinfo.page.num_tasks = 0;
+    set_u32_with_membarrier(&kinfo.page.magic, KINFO_MAGIC);
+}
+
+/**
+ * @brief publish a task handle in the page task directory
+ *
+ * Tasks that do not fit in the directory are not published, userspace then
+ * falls back to sys_get_process_handle().
+ */
+void mgr_mm_kinfo_add_task(uint32_t label, taskh_t handle)
+{
+    uint32_t entry = kinfo.page.num_tasks;
+
+    if (unlikely(entry >= KINFO_MAX_TASKS)) {
+        goto end;
+    }
+    kinfo.page.tasks[entry].label = label;
+    kinfo.page.tasks[entry].handle = handle;
+    set_u32_with_membarrier(&kinfo.page.num_tasks, entry + 1);
+end:
+    return;
+}
+
+/**
+ * @brief publish the time fields, called at each system tick
+ */
+void mgr_mm_kinfo_tick(uint64_t jiffies, uint64_t cycles)
+{
+    uint32_t seq = kinfo.page.seq;
+
+    /* odd sequence: update in progress */
+    set_u32_with_membarrier(&kinfo.page.seq, seq + 1);
+    kinfo.page.jiffies = jiffies;
+    kinfo.page.cycles = cycles;
+    request_data_membarrier();
+    set_u32_with_membarrier(&kinfo.page.seq, seq + 2);
+}
+
+/**
+ * @brief page address, as delivered to userspace
+ */
+size_t mgr_mm_kinfo_get_page(void)
+{
+    return (size_t)&kinfo;
+}
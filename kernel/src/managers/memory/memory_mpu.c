@@ -14,6 +14,8 @@
 #if defined(__arm__) || defined(__FRAMAC__)
 #include <sentry/arch/asm-cortex-m/core.h>
 #include <sentry/arch/asm-cortex-m/mpu.h>
+#include <sentry/arch/asm-cortex-m/dwt.h>
+#include <sentry/arch/asm-cortex-m/cache.h>
 #include <sentry/arch/asm-cortex-m/handler.h>
 #elif defined(__x86_64__)
 // TODO add core,mmu and handler headers (or minimum to compile)
@@ -27,9 +29,13 @@
 #include <sentry/managers/device.h>
 #include <sentry/managers/task.h>
 #include <uapi/handle.h>
+#if CONFIG_MM_KINFO_PAGE
+#include <uapi/kinfo.h>
+#endif
 
 #include <sentry/managers/memory.h>
 #include "memory.h"
+#include "memory_pool-dt.h"
 
 extern uint32_t _svtor;
 extern uint32_t _ram_start;
@@ -47,6 +53,23 @@ secure_bool_t mgr_mm_configured(void)
     return SECURE_FALSE;
 }
 
+/**
+ * @brief task memory access attributes
+ *
+ * Task text and data are cacheable when the task is placed in a memory pool
+ * declared with the outpost,cacheable property in the DTS. The svc-exchange
+ * area, at the beginning of the task data, must be mapped with the very same
+ * attributes by the kernel, so that no incoherent aliasing exists.
+ */
+__STATIC_INLINE uint32_t mgr_mm_task_region_attrs(size_t base, size_t size)
+{
+    uint32_t attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE;
+    if (memory_pool_is_cacheable(base, size) == SECURE_TRUE) {
+        attrs = MPU_REGION_ATTRS_NORMAL_CACHE;
+    }
+    return attrs;
+}
+
 /*
  * Per region function implementation, forced inline, but
  * clearer.
@@ -113,7 +136,7 @@ kstatus_t mgr_mm_resize_taskdata_to_svcexchange(taskh_t target)
         .addr = (uint32_t)meta->s_svcexchange, /* To define: where start the task RAM ? .data ? other ? */
         .size = mpu_convert_size_to_region(CONFIG_SVC_EXCHANGE_AREA_LEN),
         .access_perm = MPU_REGION_PERM_FULL,
-        .access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE,
+        .access_attrs = mgr_mm_task_region_attrs(meta->s_svcexchange, mgr_task_get_data_region_size(meta)),
         .mask = 0x0,
         .noexec = true,
         .shareable = false,
@@ -131,16 +154,46 @@ kstatus_t mgr_mm_map_task(taskh_t t)
 {
     kstatus_t status = K_ERROR_INVPARAM;
     const layout_resource_t *layout;
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    uint32_t start;
+#endif
     if (unlikely((status = mgr_task_get_layout_from_handle(t, &layout)) != K_STATUS_OKAY)) {
         pr_err("failed to get meta for task handle %x", t);
         goto err;
     }
+#ifndef CONFIG_BUILD_TARGET_RELEASE
+    start = dwt_cyccnt();
     mpu_fastload(MM_REGION_TASK_TXT, layout, TASK_MAX_RESSOURCES_NUM);
+    mgr_debug_kstat_record(KERNEL_STAT_MPU_LOAD, 0, dwt_cyccnt() - start);
+#else
+    mpu_fastload(MM_REGION_TASK_TXT, layout, TASK_MAX_RESSOURCES_NUM);
+#endif
     status = K_STATUS_OKAY;
 err:
     return status;
 }
 
+#if CONFIG_MM_REGION_CACHE
+/**
+ * @brief software MPU region cache miss handling
+ *
+ * Called on userspace MemManage data access fault. If the faulting address
+ * belongs to a resource mapped by the task but not loaded in its layout, this
+ * resource is loaded in the task layout, which is applied to the MPU at kernel
+ * handler exit, so that the faulting access can be replayed.
+ *
+ * @param[in] t: faulting task
+ * @param[in] addr: faulting address
+ *
+ * @return K_ERROR_NOENT if the address is not granted to the task (real fault),
+ *  K_STATUS_OKAY otherwise
+ */
+kstatus_t mgr_mm_region_cache_refill(taskh_t t, uint32_t addr)
+{
+    return mgr_task_refill_resource(t, addr);
+}
+#endif
+
 /**
  * Map the svc exchange area of a given task, using the kernel dev slot
  */
@@ -157,7 +210,7 @@ kstatus_t mgr_mm_map_svcexchange(taskh_t t)
             .addr = meta->s_svcexchange,
             .size = mpu_convert_size_to_region(CONFIG_SVC_EXCHANGE_AREA_LEN),
             .access_perm = MPU_REGION_PERM_PRIV,
-            .access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE,
+            .access_attrs = mgr_mm_task_region_attrs(meta->s_svcexchange, mgr_task_get_data_region_size(meta)),
             .mask = 0x0,
             .noexec = true,
             .shareable = false,
@@ -169,24 +222,28 @@ err:
     return status;
 }
 
-kstatus_t mgr_mm_unmap_device(taskh_t tsk, devh_t dev)
+/**
+ * @brief remove the user resource starting at addr from the task layout
+ *
+ * When the software MPU region cache is enabled, the resource may also be in the
+ * task overflow table.
+ *
+ * @return K_ERROR_NOENT if the resource is not mapped, K_STATUS_OKAY otherwise
+ */
+static kstatus_t mgr_mm_remove_task_resource(taskh_t tsk, uint32_t addr)
 {
     kstatus_t status = K_ERROR_INVPARAM;
-    const devinfo_t *devinfo;
-    layout_resource_t layout;
     const layout_resource_t *layout_tab;
     uint8_t id;
 
-    if (unlikely((status = mgr_device_get_info(dev, &devinfo)) != K_STATUS_OKAY)) {
-        pr_err("failed to get device meta from dev handle %x", dev);
-        goto err;
-    }
     if (unlikely((status = mgr_task_get_layout_from_handle(tsk, &layout_tab)) != K_STATUS_OKAY)) {
         pr_err("failed to get task ressource layout from task handle %x", tsk);
         goto err;
     }
-    if (unlikely((status = mpu_get_id_from_address(layout_tab, TASK_MAX_RESSOURCES_NUM, (uint32_t)devinfo->baseaddr, &id)) != K_STATUS_OKAY)) {
-        pr_err("device %x not found in mapped layout", dev);
+    if (unlikely((status = mpu_get_id_from_address(layout_tab, TASK_MAX_RESSOURCES_NUM, addr, &id)) != K_STATUS_OKAY)) {
+#if CONFIG_MM_REGION_CACHE
+        status = mgr_task_remove_overflow_resource(tsk, addr);
+#endif
         goto err;
     }
     status = mgr_task_remove_resource(tsk, mgr_mm_region_to_layout_id(id));
@@ -194,18 +251,41 @@ err:
     return status;
 }
 
-kstatus_t mgr_mm_map_device(taskh_t tsk, devh_t dev)
+kstatus_t mgr_mm_unmap_device(taskh_t tsk, devh_t dev)
 {
     kstatus_t status = K_ERROR_INVPARAM;
     const devinfo_t *devinfo;
-    struct mpu_region_desc mpu_cfg;
-    layout_resource_t layout;
-    const layout_resource_t *layout_tab;
 
     if (unlikely((status = mgr_device_get_info(dev, &devinfo)) != K_STATUS_OKAY)) {
         pr_err("failed to get device meta from dev handle %x", dev);
         goto err;
     }
+    if (unlikely((status = mgr_mm_remove_task_resource(tsk, (uint32_t)devinfo->baseaddr)) != K_STATUS_OKAY)) {
+        pr_err("device %x not found in mapped layout", dev);
+        goto err;
+    }
+err:
+    return status;
+}
+
+/**
+ * @brief forge a user resource and add it to the task layout
+ *
+ * The resource is added to the first free slot of the task layout. If none is
+ * free and the software MPU region cache is enabled, the resource is added to the
+ * task overflow table instead, and loaded in the task layout at first access.
+ *
+ * @param[in] tsk: task to which the resource is added
+ * @param[in,out] mpu_cfg: resource region descriptor, all fields but id being set
+ *
+ * @return K_ERROR_BUSY if no slot is free, K_STATUS_OKAY otherwise
+ */
+static kstatus_t mgr_mm_add_task_resource(taskh_t tsk, struct mpu_region_desc *mpu_cfg)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    layout_resource_t layout;
+    const layout_resource_t *layout_tab;
+
     if (unlikely((status = mgr_task_get_layout_from_handle(tsk, &layout_tab)) != K_STATUS_OKAY)) {
         pr_err("failed to get task ressource layout from task handle %x", tsk);
         goto err;
@@ -216,9 +296,16 @@ kstatus_t mgr_mm_map_device(taskh_t tsk, devh_t dev)
      * correspond to region 2 (see kernel and task memory mapping) as the kernel has locked
      * regions 0 and 1 for itself.
      */
-    if (unlikely((status = mpu_get_free_id(layout_tab, TASK_MAX_RESSOURCES_NUM, &mpu_cfg.id)) != K_STATUS_OKAY)) {
-        pr_err("no free slot to map device");
+    if (unlikely(mpu_get_free_id(layout_tab, TASK_MAX_RESSOURCES_NUM, &mpu_cfg->id) != K_STATUS_OKAY)) {
+#if CONFIG_MM_REGION_CACHE
+        /* the region number is set when loaded in the task layout */
+        mpu_cfg->id = 0;
+        status = mpu_forge_resource(mpu_cfg, &layout);
+        /*@ assert status == K_STATUS_OKAY; */
+        status = mgr_task_add_overflow_resource(tsk, layout);
+#else
         status = K_ERROR_BUSY;
+#endif
         goto err;
     }
 #if ! MPU_FASTLOAD_ALIGNED
@@ -226,24 +313,38 @@ kstatus_t mgr_mm_map_device(taskh_t tsk, devh_t dev)
      * on the id field, while in the other case, it is set separatedly */
     /** FIXME: this fix should be fully invisible here and being instead managed in mpu
      * arch-specific backend, such as pmsav7 vs pmsav8 */
-    mpu_cfg.id += 2; /* as layout starts at task TXT, defined as reg 2, it must be incremented */
+    mpu_cfg->id += 2; /* as layout starts at task TXT, defined as reg 2, it must be incremented */
 #endif
-    mpu_cfg.addr = (uint32_t)devinfo->baseaddr;
-    mpu_cfg.size = mpu_convert_size_to_region(devinfo->size);
+    status = mpu_forge_resource(mpu_cfg, &layout);
+    /*@ assert status == K_STATUS_OKAY; */
+    status = mgr_task_add_resource(tsk, mpu_cfg->id, layout);
+    if (unlikely(status != K_STATUS_OKAY)) {
+        /* should not happen as already checked when getting free id */
+        /*@ assert false; */
+        status = K_ERROR_BUSY;
+    }
+err:
+    return status;
+}
+
+kstatus_t mgr_mm_map_device(taskh_t tsk, devh_t dev)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    const devinfo_t *devinfo;
+    struct mpu_region_desc mpu_cfg;
+
+    if (unlikely((status = mgr_device_get_info(dev, &devinfo)) != K_STATUS_OKAY)) {
+        pr_err("failed to get device meta from dev handle %x", dev);
+        goto err;
+    }
+    mpu_set_region_layout(&mpu_cfg, (uint32_t)devinfo->baseaddr, devinfo->size);
     mpu_cfg.access_perm = MPU_REGION_PERM_FULL; /* RW for priv+user */
     mpu_cfg.access_attrs = MPU_REGION_ATTRS_DEVICE;
-    mpu_cfg.mask = 0x0;
     mpu_cfg.noexec = true;
     mpu_cfg.shareable = false;
-    status = mpu_forge_resource(&mpu_cfg, &layout);
-    /*@ assert status == K_STATUS_OKAY; */
-
-    status = mgr_task_add_resource(tsk, mpu_cfg.id, layout);
+    status = mgr_mm_add_task_resource(tsk, &mpu_cfg);
     if (unlikely(status != K_STATUS_OKAY)) {
-        /* should not happen as already checked when getting free id */
-        /*@ assert false; */
         pr_err("no free slot to map device");
-        status = K_ERROR_BUSY;
         goto err;
     }
     /*@ assert status == K_STATUS_OKAY; */
@@ -257,18 +358,25 @@ kstatus_t mgr_mm_map_shm(taskh_t tsk, shmh_t shm)
     kstatus_t status = K_ERROR_INVPARAM;
     const shm_meta_t *shm_meta;
     struct mpu_region_desc mpu_cfg;
-    layout_resource_t layout;
-    const layout_resource_t *layout_tab;
     secure_bool_t result;
     shm_user_t user;
 
     if (unlikely((status = mgr_mm_shm_get_meta(shm, &shm_meta)) != K_STATUS_OKAY)) {
         goto err;
     }
+    /*
+     * detect if tsk is owner, user or reader. The accessor is resolved once and
+     * then used for all the accessor-based checks, so that the reader lookup
+     * is not done again for each of them.
+     */
     status = mgr_mm_shm_get_task_type(shm, tsk, &user);
     if (unlikely(status != K_STATUS_OKAY)) {
         goto err;
     }
+    if (unlikely(user == SHM_TSK_NONE)) {
+        status = K_ERROR_INVPARAM;
+        goto err;
+    }
     status = mgr_mm_shm_is_mappable_by(shm, user, &result);
     if (unlikely(status != K_STATUS_OKAY)) {
         goto err;
@@ -279,12 +387,6 @@ kstatus_t mgr_mm_map_shm(taskh_t tsk, shmh_t shm)
         status = K_ERROR_DENIED;
         goto err;
     }
-    /* detect if tsk is owner or user. must not fail */
-    status = mgr_mm_shm_get_task_type(shm, tsk, &user);
-    /*@ assert (status == K_STATUS_OKAY); */
-    if (unlikely(user == SHM_TSK_NONE)) {
-        goto err;
-    }
     /* now that we know who is requesting, check user-related flags */
     status = mgr_mm_shm_is_mapped_by(shm, user, &result);
     /*@ assert (result == K_STATUS_OKAY); */
@@ -293,29 +395,7 @@ kstatus_t mgr_mm_map_shm(taskh_t tsk, shmh_t shm)
         status = K_ERROR_BADSTATE;
         goto err;
     }
-    if (unlikely((status = mgr_task_get_layout_from_handle(tsk, &layout_tab)) != K_STATUS_OKAY)) {
-        goto err;
-    }
-    /**
-     * NOTE: here, we ask for the first empty field in task layout.
-     * This field id must be incremented of 2 (<<1) as the first region of th layout_tab
-     * correspond to region 2 (see kernel and task memory mapping) as the kernel has locked
-     * regions 0 and 1 for itself.
-     */
-    if (unlikely((status = mpu_get_free_id(layout_tab, TASK_MAX_RESSOURCES_NUM, &mpu_cfg.id)) != K_STATUS_OKAY)) {
-        status = K_ERROR_BUSY;
-        goto err;
-    }
-
-#if ! MPU_FASTLOAD_ALIGNED
-    /* in MPU that allow block-mapping from any region number, the region number is based
-     * on the id field, while in the other case, it is set separatedly */
-    /** FIXME: this fix should be fully invisible here and being instead managed in mpu
-     * arch-specific backend, such as pmsav7 vs pmsav8 */
-    mpu_cfg.id += 2; /* as layout starts at task TXT, defined as reg2, it must be incremented */
-#endif
-    mpu_cfg.addr = (uint32_t)shm_meta->baseaddr;
-    mpu_cfg.size = mpu_convert_size_to_region(shm_meta->size);
+    mpu_set_region_layout(&mpu_cfg, (uint32_t)shm_meta->baseaddr, shm_meta->size);
 
     /* used writeable flags declared in config */
     if (unlikely((status = mgr_mm_shm_is_writeable_by(shm, user, &result)) != K_STATUS_OKAY)) {
@@ -326,17 +406,16 @@ kstatus_t mgr_mm_map_shm(taskh_t tsk, shmh_t shm)
     } else {
         mpu_cfg.access_perm = MPU_REGION_PERM_RO; /* RO for priv+user */
     }
-    mpu_cfg.access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE;
-    mpu_cfg.mask = 0x0;
+    /* cacheability is declared in DTS, same for owner and user */
+    if (shm_meta->is_cacheable == SECURE_TRUE) {
+        mpu_cfg.access_attrs = MPU_REGION_ATTRS_NORMAL_CACHE;
+    } else {
+        mpu_cfg.access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE;
+    }
     mpu_cfg.noexec = true;
     mpu_cfg.shareable = false;
-    status = mpu_forge_resource(&mpu_cfg, &layout);
-    /*@ assert status == K_STATUS_OKAY; */
-    status = mgr_task_add_resource(tsk, mpu_cfg.id, layout);
+    status = mgr_mm_add_task_resource(tsk, &mpu_cfg);
     if (unlikely(status != K_STATUS_OKAY)) {
-        /* should not happen as already checked when getting free id */
-        /*@ assert false; */
-        status = K_ERROR_BUSY;
         goto err;
     }
     status = mgr_mm_shm_set_mapflag(shm, user, SECURE_TRUE);
@@ -349,19 +428,12 @@ kstatus_t mgr_mm_unmap_shm(taskh_t tsk, shmh_t shm)
 {
     kstatus_t status = K_ERROR_INVPARAM;
     const shm_meta_t *shm_meta;
-    layout_resource_t layout;
-    const layout_resource_t *layout_tab;
-    secure_bool_t result;
     shm_user_t user;
-    uint8_t id;
 
     if (unlikely((status = mgr_mm_shm_get_meta(shm, &shm_meta)) != K_STATUS_OKAY)) {
         goto err;
     }
-    if (unlikely((status = mgr_task_get_layout_from_handle(tsk, &layout_tab)) != K_STATUS_OKAY)) {
-        goto err;
-    }
-    if (unlikely((status = mpu_get_id_from_address(layout_tab, TASK_MAX_RESSOURCES_NUM, (uint32_t)shm_meta->baseaddr, &id)) != K_STATUS_OKAY)) {
+    if (unlikely((status = mgr_mm_remove_task_resource(tsk, (uint32_t)shm_meta->baseaddr)) != K_STATUS_OKAY)) {
         goto err;
     }
     /* detect if tsk is owner or user. must not fail */
@@ -371,8 +443,6 @@ kstatus_t mgr_mm_unmap_shm(taskh_t tsk, shmh_t shm)
         /* this should not happen ! */
         panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
     }
-    status = mgr_task_remove_resource(tsk, mgr_mm_region_to_layout_id(id));
-    /*@ assert (status == K_STATUS_OKAY); */
 
     status = mgr_mm_shm_set_mapflag(shm, user, SECURE_FALSE);
     /*@ assert (status == K_STATUS_OKAY); */
@@ -380,6 +450,104 @@ err:
     return status;
 }
 
+/**
+ * @brief transfer the user credentials of a SHM from a task to another
+ *
+ * The sender must be the SHM owner or user, and the SHM user credentials must
+ * be transferable. The sender mapping is revoked, the receiver becomes the SHM
+ * user, and is mapped if its credentials allow it. When the owner transfers the
+ * SHM, the previous user must not have it mapped. Read-only readers can neither
+ * send nor receive the SHM user credentials.
+ *
+ * If the receiver can't be mapped (no free MPU resource), the transfer is
+ * reverted, so that the SHM state is left unmodified.
+ * The previous user DMA pool buffers are left untouched, the caller releases
+ * them once the transfer can no longer be reverted.
+ *
+ * @return K_ERROR_INVPARAM if the SHM is not accessible by the sender,
+ *  K_ERROR_DENIED if the credentials are not transferable, K_ERROR_BUSY if the SHM
+ *  is mapped by its previous user or if the receiver can't be mapped
+ */
+kstatus_t mgr_mm_shm_transfer(shmh_t shm, taskh_t from, taskh_t to)
+{
+    kstatus_t status;
+    shm_user_t sender;
+    shm_user_t receiver;
+    taskh_t prev_user;
+    secure_bool_t result;
+    secure_bool_t sender_mapped;
+
+    if (unlikely((status = mgr_mm_shm_get_task_type(shm, from, &sender)) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    if (unlikely(sender == SHM_TSK_NONE)) {
+        status = K_ERROR_INVPARAM;
+        goto err;
+    }
+    if (unlikely(SHM_TSK_IS_READER(sender))) {
+        /* readers are read-only, they never own the SHM user slot */
+        status = K_ERROR_DENIED;
+        goto err;
+    }
+    if (unlikely((status = mgr_mm_shm_get_task_type(shm, to, &receiver)) != K_STATUS_OKAY)) {
+        goto err;
+    }
+    if (unlikely(SHM_TSK_IS_READER(receiver))) {
+        status = K_ERROR_INVPARAM;
+        goto err;
+    }
+    status = mgr_mm_shm_is_transferable(shm, &result);
+    /*@ assert (status == K_STATUS_OKAY); */
+    if (unlikely(result != SECURE_TRUE)) {
+        status = K_ERROR_DENIED;
+        goto err;
+    }
+    status = mgr_mm_shm_get_user(shm, &prev_user);
+    /*@ assert (status == K_STATUS_OKAY); */
+    if (prev_user != from) {
+        /* owner transfer, the previous user must have released the SHM */
+        status = mgr_mm_shm_is_mapped_by(shm, SHM_TSK_USER, &result);
+        /*@ assert (status == K_STATUS_OKAY); */
+        if (unlikely(result == SECURE_TRUE)) {
+            status = K_ERROR_BUSY;
+            goto err;
+        }
+    }
+    status = mgr_mm_shm_is_mapped_by(shm, sender, &sender_mapped);
+    /*@ assert (status == K_STATUS_OKAY); */
+    if (sender_mapped == SECURE_TRUE) {
+        status = mgr_mm_unmap_shm(from, shm);
+        /*@ assert (status == K_STATUS_OKAY); */
+    }
+    status = mgr_mm_shm_declare_user(shm, to);
+    /*@ assert (status == K_STATUS_OKAY); */
+    status = mgr_mm_shm_get_task_type(shm, to, &receiver);
+    /*@ assert (status == K_STATUS_OKAY); */
+    status = mgr_mm_shm_is_mapped_by(shm, receiver, &result);
+    /*@ assert (status == K_STATUS_OKAY); */
+    if (result == SECURE_TRUE) {
+        /* giving back the SHM to its owner, that still has it mapped */
+        goto err;
+    }
+    status = mgr_mm_shm_is_mappable_by(shm, receiver, &result);
+    /*@ assert (status == K_STATUS_OKAY); */
+    if (result != SECURE_TRUE) {
+        /* receiver will have to be granted map permission later */
+        goto err;
+    }
+    status = mgr_mm_map_shm(to, shm);
+    if (unlikely(status != K_STATUS_OKAY)) {
+        /* revert, the sender resource slot has just been released */
+        mgr_mm_shm_declare_user(shm, prev_user);
+        if (sender_mapped == SECURE_TRUE) {
+            mgr_mm_map_shm(from, shm);
+        }
+        status = K_ERROR_BUSY;
+    }
+err:
+    return status;
+}
+
 
 /*
  * @brief initialize MPU and configure kernel layout
@@ -408,6 +576,11 @@ err:
  * [MPU REG 6] [ task ressources bank 1, if needed ] [---] [---]
  * [MPU REG 7] [ task ressources bank 1, if needed ] [---] [---]
  *
+ * With CONFIG_MM_KINFO_PAGE, the kernel information page uses the first
+ * ressource slot:
+ *
+ * [MPU REG 4] [ kernel information page           ] [RW-] [R--]
+ *
  */
 kstatus_t mgr_mm_init(void)
 {
@@ -421,7 +594,12 @@ kstatus_t mgr_mm_init(void)
     status = mgr_mm_map_kernel_data();
     /*@ assert (status == K_STATUS_OKAY); */
     mpu_enable();
+    /* cacheability attributes are now set, caches can be enabled, if any */
+    arch_cache_enable();
     mm_configured = SECURE_TRUE;
+#endif
+#if CONFIG_MM_KINFO_PAGE
+    mgr_mm_kinfo_init();
 #endif
     /*@ assert (status == K_STATUS_OKAY); */
     return status;
@@ -465,26 +643,36 @@ kstatus_t mgr_mm_forge_ressource(mm_region_t reg_type, taskh_t t, layout_resourc
     switch (reg_type) {
         case MM_REGION_TASK_TXT:
             mpu_cfg.id = MM_REGION_TASK_TXT;
-            mpu_cfg.addr = (uint32_t)meta->s_text;
-            mpu_cfg.size = mpu_convert_size_to_region(mgr_task_get_text_region_size(meta));
+            mpu_set_region_layout(&mpu_cfg, (uint32_t)meta->s_text, mgr_task_get_text_region_size(meta));
             mpu_cfg.access_perm = MPU_REGION_PERM_RO;
-            mpu_cfg.access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE;
-            mpu_cfg.mask = 0x0;
+            mpu_cfg.access_attrs = mgr_mm_task_region_attrs(meta->s_text, mgr_task_get_text_region_size(meta));
             mpu_cfg.noexec = false;
             mpu_cfg.shareable = false;
             mpu_forge_resource(&mpu_cfg, ressource);
             break;
         case MM_REGION_TASK_DATA:
             mpu_cfg.id = MM_REGION_TASK_DATA;
-            mpu_cfg.addr = (uint32_t)meta->s_svcexchange; /* To define: where start the task RAM ? .data ? other ? */
-            mpu_cfg.size = mpu_convert_size_to_region(mgr_task_get_data_region_size(meta));   /* FIXME data_size is a concat of all datas sections */
+            /* To define: where start the task RAM ? .data ? other ? */
+            /* FIXME data_size is a concat of all datas sections */
+            mpu_set_region_layout(&mpu_cfg, (uint32_t)meta->s_svcexchange, mgr_task_get_data_region_size(meta));
             mpu_cfg.access_perm = MPU_REGION_PERM_FULL;
+            mpu_cfg.access_attrs = mgr_mm_task_region_attrs(meta->s_svcexchange, mgr_task_get_data_region_size(meta));
+            mpu_cfg.noexec = true;
+            mpu_cfg.shareable = false;
+            mpu_forge_resource(&mpu_cfg, ressource);
+            break;
+#if CONFIG_MM_KINFO_PAGE
+        case MM_REGION_TASK_KINFO:
+            /* kernel written, overlaps the kernel data region, user read-only */
+            mpu_cfg.id = MM_REGION_TASK_KINFO;
+            mpu_set_region_layout(&mpu_cfg, (uint32_t)mgr_mm_kinfo_get_page(), KINFO_PAGE_SIZE);
+            mpu_cfg.access_perm = MPU_REGION_PERM_UNPRIV_RO;
             mpu_cfg.access_attrs = MPU_REGION_ATTRS_NORMAL_NOCACHE;
-            mpu_cfg.mask = 0x0;
             mpu_cfg.noexec = true;
             mpu_cfg.shareable = false;
             mpu_forge_resource(&mpu_cfg, ressource);
             break;
+#endif
         case MM_REGION_TASK_RESSOURCE_DEVICE:
             /* TODO for other ressources */
             break;
@@ -562,3 +750,45 @@ kstatus_t mgr_mm_unmap_kdev(void)
     }
     return status;
 }
+
+/**
+ * @brief write back the data cache content of a given memory area
+ *
+ * The caller is responsible for checking that the area is owned by the
+ * requester. This has no effect on cores without data cache.
+ *
+ * @param[in] addr: memory area start address
+ * @param[in] len: memory area length in bytes
+ */
+kstatus_t mgr_mm_dcache_clean(size_t addr, size_t len)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    if (unlikely((addr + len) < addr)) {
+        goto err;
+    }
+    arch_dcache_clean_range(addr, len);
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
+/**
+ * @brief discard the data cache content of a given memory area
+ *
+ * The caller is responsible for checking that the area is owned, and writeable,
+ * by the requester. This has no effect on cores without data cache.
+ *
+ * @param[in] addr: memory area start address
+ * @param[in] len: memory area length in bytes
+ */
+kstatus_t mgr_mm_dcache_invalidate(size_t addr, size_t len)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    if (unlikely((addr + len) < addr)) {
+        goto err;
+    }
+    arch_dcache_invalidate_range(addr, len);
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
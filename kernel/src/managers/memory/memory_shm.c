@@ -5,7 +5,10 @@
 #include <sentry/arch/asm-generic/panic.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/memory.h>
+#include <sentry/zlib/math.h>
 #include <uapi/handle.h>
+#include <uapi/ring.h>
+#include <uapi/types.h>
 
 #include "memory_shm-dt.h"
 #include "memory.h"
@@ -18,6 +21,19 @@ typedef struct shm_user_state {
     taskh_t            task;
 } shm_user_state_t;
 
+/**
+ * DMA pool allocator state. Allocations are contiguous runs of fixed-size
+ * blocks, tracked in a bitmap. Each allocation length and owner is stored at
+ * its first block index.
+ */
+typedef struct shm_dma_pool {
+    uint32_t           used;        /**< allocated blocks bitmap */
+    uint8_t            num_blocks;  /**< number of blocks in the pool */
+    uint8_t            block_shift; /**< log2 of the block size */
+    uint8_t            len[SHM_DMA_POOL_MAX_BLOCKS];   /**< allocation length, in blocks */
+    taskh_t            owner[SHM_DMA_POOL_MAX_BLOCKS]; /**< allocating task */
+} shm_dma_pool_t;
+
 typedef struct shm_info {
     shmh_t             handle;
     shm_meta_t  const *meta;
@@ -25,10 +41,110 @@ typedef struct shm_info {
     secure_bool_t      is_shared;
     shm_user_state_t   owner;
     shm_user_state_t   user;
+    /* read-only readers, compacted at reader removal */
+    uint8_t            num_readers;
+    shm_user_state_t   readers[SHM_MAX_READERS];
+    /* ring mode kernel-side state, never read back from the SHM */
+    uint32_t           ring_capacity;
+    uint32_t           ring_head;  /*< head at the last producer doorbell */
+    uint32_t           ring_tail;  /*< tail at the last consumer doorbell */
+    /* DMA pool allocator, NULL if the SHM is not a DMA pool */
+    shm_dma_pool_t    *dma_pool;
 } shm_info_t;
 
 static shm_info_t shm_table[SHM_LIST_SIZE];
 
+#if SHM_DMA_POOL_NUM > 0
+static shm_dma_pool_t shm_dma_pools[SHM_DMA_POOL_NUM];
+#endif
+
+/**
+ * @brief get the reader state corresponding to the given reader accessor
+ *
+ * @return NULL if the accessor is not a declared reader of the SHM
+ */
+static shm_user_state_t *shm_get_reader(shm_info_t *info, shm_user_t accessor)
+{
+    shm_user_state_t *reader = NULL;
+    size_t idx;
+
+    if (!SHM_TSK_IS_READER(accessor)) {
+        goto end;
+    }
+    idx = (size_t)accessor - SHM_TSK_READER;
+    if (unlikely(idx >= info->num_readers)) {
+        goto end;
+    }
+    /*@ assert idx < SHM_MAX_READERS; */
+    reader = &info->readers[idx];
+end:
+    return reader;
+}
+
+/**
+ * @brief initialize the ring header of a ring-mode SHM
+ *
+ * The ring capacity is the largest power of two that fits in the SHM after
+ * the header. The kernel keeps its own copy of the ring geometry, so that a
+ * task corrupting the header can't make the kernel read outside of the SHM.
+ */
+static void mgr_mm_shm_ring_init(shm_info_t *info)
+{
+    volatile shm_ring_t *ring = (volatile shm_ring_t*)info->meta->baseaddr;
+    size_t data_len;
+
+    if (unlikely(info->meta->size <= sizeof(shm_ring_t))) {
+        /* dts ring SHM too small to hold even a single byte */
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    data_len = info->meta->size - sizeof(shm_ring_t);
+    info->ring_capacity = FLOOR_POW2(data_len);
+    if (unlikely(info->meta->ring_watermark > info->ring_capacity)) {
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    info->ring_head = 0;
+    info->ring_tail = 0;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->capacity = info->ring_capacity;
+    ring->watermark = info->meta->ring_watermark;
+}
+
+#if SHM_DMA_POOL_NUM > 0
+/**
+ * @brief initialize the block allocator of a DMA pool SHM
+ *
+ * Blocks are aligned on their size, so that any allocated buffer is aligned
+ * for the GPDMA beats and, when cacheable, on cache lines. A pool holding
+ * more than SHM_DMA_POOL_MAX_BLOCKS blocks is rejected, instead of leaving
+ * the remaining of the SHM silently unused.
+ */
+static void mgr_mm_shm_dma_pool_init(shm_info_t *info, shm_dma_pool_t *pool)
+{
+    uint32_t block_size = info->meta->dma_block_size;
+    size_t num_blocks;
+
+    if (unlikely(!IS_POW2(block_size) || (block_size < sizeof(uint32_t)))) {
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    if (unlikely((info->meta->baseaddr & (block_size - 1UL)) != 0)) {
+        /* dts SHM base address must be aligned on the block size */
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    num_blocks = info->meta->size / block_size;
+    if (unlikely((num_blocks == 0) || (num_blocks > SHM_DMA_POOL_MAX_BLOCKS))) {
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    pool->used = 0;
+    for (size_t block = 0; block < SHM_DMA_POOL_MAX_BLOCKS; ++block) {
+        pool->len[block] = 0;
+    }
+    pool->num_blocks = (uint8_t)num_blocks;
+    pool->block_shift = (uint8_t)__builtin_ctz(block_size);
+    info->dma_pool = pool;
+}
+#endif
+
 /**
  * @fn initialize the SHM dynamic table
  *
@@ -39,6 +155,9 @@ kstatus_t mgr_mm_shm_init(void)
 {
     kstatus_t status = K_STATUS_OKAY;
     kshmh_t ksh;
+#if SHM_DMA_POOL_NUM > 0
+    size_t dma_pool_id = 0;
+#endif
 
 #if SHM_LIST_SIZE > 0
     /* useless, size-limit warn, if shm list is empty */
@@ -73,6 +192,23 @@ kstatus_t mgr_mm_shm_init(void)
         shm_table[id].user.config.mappable = SECURE_FALSE;
         /* at init time, shm is not shared and user is owner */
         shm_table[id].user.task = shm_table[id].owner.task;
+        shm_table[id].num_readers = 0;
+        if (unlikely(shm_table[id].meta->max_readers > SHM_MAX_READERS)) {
+            /* this should never happen, SHM_MAX_READERS is built from dts */
+            panic(PANIC_CONFIGURATION_MISMATCH);
+        }
+        shm_table[id].ring_capacity = 0;
+        if (shm_table[id].meta->is_ring == SECURE_TRUE) {
+            mgr_mm_shm_ring_init(&shm_table[id]);
+        }
+        shm_table[id].dma_pool = NULL;
+#if SHM_DMA_POOL_NUM > 0
+        if (shm_table[id].meta->is_dma_pool == SECURE_TRUE) {
+            /*@ assert dma_pool_id < SHM_DMA_POOL_NUM; */
+            mgr_mm_shm_dma_pool_init(&shm_table[id], &shm_dma_pools[dma_pool_id]);
+            dma_pool_id++;
+        }
+#endif
     }
 end:
 #endif
@@ -110,6 +246,12 @@ kstatus_t mgr_mm_shm_get_task_type(shmh_t shm, taskh_t task, shm_user_t *accesso
         *accessor = SHM_TSK_USER;
     } else {
         *accessor = SHM_TSK_NONE;
+        for (uint8_t idx = 0; idx < shm_table[kshm->id].num_readers; ++idx) {
+            if (shm_table[kshm->id].readers[idx].task == task) {
+                *accessor = (shm_user_t)(SHM_TSK_READER + idx);
+                break;
+            }
+        }
     }
     status = K_STATUS_OKAY;
 end:
@@ -145,6 +287,355 @@ end:
     return status;
 }
 
+/**
+ * @brief declare, or update, a read-only reader of the given SHM
+ *
+ * Readers are additional tasks that can map the SHM read-only, while the SHM
+ * user stays the single writer. The number of readers is bounded by the SHM
+ * outpost,max-readers DTS property. The owner and the user can't be readers.
+ *
+ * @return K_ERROR_NOENT if the SHM do not support readers, K_ERROR_BUSY if all
+ *  the reader slots are used or if the reader has the SHM mapped
+ */
+kstatus_t mgr_mm_shm_declare_reader(shmh_t shm, taskh_t task, shm_config_t const *config)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    shm_info_t *info;
+    shm_user_state_t *reader = NULL;
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely(config == NULL)) {
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    info = &shm_table[kshm->id];
+    if (unlikely((task == info->owner.task) || (task == info->user.task))) {
+        goto end;
+    }
+    for (uint8_t idx = 0; idx < info->num_readers; ++idx) {
+        if (info->readers[idx].task == task) {
+            reader = &info->readers[idx];
+            break;
+        }
+    }
+    if (reader == NULL) {
+        if (unlikely(info->meta->max_readers == 0)) {
+            status = K_ERROR_NOENT;
+            goto end;
+        }
+        if (unlikely(info->num_readers >= info->meta->max_readers)) {
+            status = K_ERROR_BUSY;
+            goto end;
+        }
+        reader = &info->readers[info->num_readers];
+        reader->task = task;
+        reader->is_mapped = SECURE_FALSE;
+        info->num_readers++;
+    } else if (unlikely(reader->is_mapped == SECURE_TRUE)) {
+        /* can't update the creds of a reader that has the SHM mapped */
+        status = K_ERROR_BUSY;
+        goto end;
+    }
+    reader->config.mappable = config->mappable;
+    reader->config.rw = SECURE_FALSE;
+    reader->config.transferable = SECURE_FALSE;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief remove a read-only reader of the given SHM
+ *
+ * @return K_ERROR_BUSY if the reader has the SHM mapped
+ */
+kstatus_t mgr_mm_shm_remove_reader(shmh_t shm, taskh_t task)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    shm_info_t *info;
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    info = &shm_table[kshm->id];
+    for (uint8_t idx = 0; idx < info->num_readers; ++idx) {
+        if (info->readers[idx].task != task) {
+            continue;
+        }
+        if (unlikely(info->readers[idx].is_mapped == SECURE_TRUE)) {
+            status = K_ERROR_BUSY;
+            goto end;
+        }
+        /* keep the readers table compact, reader accessors are not persistent */
+        info->num_readers--;
+        info->readers[idx] = info->readers[info->num_readers];
+        status = K_STATUS_OKAY;
+        break;
+    }
+end:
+    return status;
+}
+
+/**
+ * @brief bitmap mask of a run of n blocks, starting at block 0
+ */
+static inline uint32_t shm_dma_pool_mask(size_t n)
+{
+    return (n >= SHM_DMA_POOL_MAX_BLOCKS) ? UINT32_MAX : (uint32_t)((1UL << n) - 1UL);
+}
+
+/**
+ * @brief find the first run of n free blocks in a DMA pool
+ *
+ * Windows holding a used block are skipped up to the block following the
+ * highest used one, so that the lookup costs at most one step per used run.
+ *
+ * @return the first block index of the run, or -1 if no run is free
+ */
+static int shm_dma_pool_find(shm_dma_pool_t const *pool, uint8_t n)
+{
+    uint32_t mask = shm_dma_pool_mask(n);
+    uint8_t pos = 0;
+    int first = -1;
+
+    while ((pos + n) <= pool->num_blocks) {
+        /* pos < SHM_DMA_POOL_MAX_BLOCKS as n > 0 */
+        uint32_t window = (pool->used >> pos) & mask;
+        if (window == 0) {
+            first = pos;
+            break;
+        }
+        pos += (uint8_t)(32 - __builtin_clz(window));
+    }
+    return first;
+}
+
+/**
+ * @brief allocate a buffer in the given DMA pool SHM
+ *
+ * The buffer is a contiguous run of blocks, owned by the allocating task
+ * that must be the SHM owner or user. The buffer offset, relative to the SHM
+ * base address, is aligned on the DMA pool block size.
+ *
+ * Only the ownership is tracked: DMA streams are not bound to an allocated
+ * buffer, their memory endpoint stays the whole SHM declared in the DTS.
+ *
+ * @return K_ERROR_NOENT if the SHM is not a DMA pool, K_ERROR_DENIED if the
+ *  task is neither the SHM owner nor user, K_ERROR_MEMFAIL if no free run
+ *  large enough exists
+ */
+kstatus_t mgr_mm_shm_dma_alloc(shmh_t shm, taskh_t task, size_t len, size_t *offset)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    shm_dma_pool_t *pool;
+    size_t nblocks;
+    int first;
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely((offset == NULL) || (len == 0))) {
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    pool = shm_table[kshm->id].dma_pool;
+    if (unlikely(pool == NULL)) {
+        status = K_ERROR_NOENT;
+        goto end;
+    }
+    if (unlikely((task != shm_table[kshm->id].owner.task) &&
+                 (task != shm_table[kshm->id].user.task))) {
+        status = K_ERROR_DENIED;
+        goto end;
+    }
+    if (unlikely(len > ((size_t)pool->num_blocks << pool->block_shift))) {
+        status = K_ERROR_MEMFAIL;
+        goto end;
+    }
+    nblocks = DIV_ROUND_UP(len, 1UL << pool->block_shift);
+    first = shm_dma_pool_find(pool, (uint8_t)nblocks);
+    if (unlikely(first < 0)) {
+        status = K_ERROR_MEMFAIL;
+        goto end;
+    }
+    /*@ assert 0 <= first < SHM_DMA_POOL_MAX_BLOCKS; */
+    pool->used |= shm_dma_pool_mask(nblocks) << first;
+    pool->len[first] = (uint8_t)nblocks;
+    pool->owner[first] = task;
+    *offset = (size_t)first << pool->block_shift;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief release a buffer previously allocated in the given DMA pool SHM
+ *
+ * Only the task that has allocated the buffer can release it.
+ *
+ * @return K_ERROR_NOENT if the SHM is not a DMA pool, K_ERROR_INVPARAM if
+ *  offset is not an allocated buffer, K_ERROR_DENIED if the buffer is owned
+ *  by another task
+ */
+kstatus_t mgr_mm_shm_dma_free(shmh_t shm, taskh_t task, size_t offset)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    shm_dma_pool_t *pool;
+    size_t first;
+    uint8_t nblocks;
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    pool = shm_table[kshm->id].dma_pool;
+    if (unlikely(pool == NULL)) {
+        status = K_ERROR_NOENT;
+        goto end;
+    }
+    first = offset >> pool->block_shift;
+    if (unlikely(((offset & ((1UL << pool->block_shift) - 1UL)) != 0) ||
+                 (first >= pool->num_blocks))) {
+        goto end;
+    }
+    nblocks = pool->len[first];
+    if (unlikely((nblocks == 0) || ((pool->used & (1UL << first)) == 0))) {
+        /* not the first block of an allocated buffer */
+        goto end;
+    }
+    if (unlikely(pool->owner[first] != task)) {
+        status = K_ERROR_DENIED;
+        goto end;
+    }
+    pool->used &= ~(shm_dma_pool_mask(nblocks) << first);
+    pool->len[first] = 0;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief release all the buffers owned by a task in a DMA pool
+ *
+ * Blocks of non-mappable pools hold kernel-built GPDMA linked-list tables,
+ * that may still be loaded by a channel. These are only released by the DMA
+ * manager, at stream unassignment.
+ */
+static void shm_dma_pool_release(shm_info_t const *info, taskh_t task)
+{
+    shm_dma_pool_t *pool = info->dma_pool;
+
+    if ((pool == NULL) || (info->meta->is_mappable != SECURE_TRUE)) {
+        goto end;
+    }
+    for (uint8_t first = 0; first < pool->num_blocks; ++first) {
+        uint8_t nblocks = pool->len[first];
+        if ((nblocks != 0) && (pool->owner[first] == task)) {
+            pool->used &= ~(shm_dma_pool_mask(nblocks) << first);
+            pool->len[first] = 0;
+        }
+    }
+end:
+    return;
+}
+
+/**
+ * @brief release the DMA pool buffers of a task that no longer accesses the SHM
+ *
+ * Called at SHM transfer time, for the task that has lost the SHM user
+ * credentials, so that its buffers can be reallocated.
+ *
+ * @return K_ERROR_INVPARAM if the SHM handle is invalid, K_ERROR_BUSY if the
+ *  task is still the SHM owner or user
+ */
+kstatus_t mgr_mm_shm_dma_release(shmh_t shm, taskh_t task)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    if (unlikely((task == shm_table[kshm->id].owner.task) ||
+                 (task == shm_table[kshm->id].user.task))) {
+        status = K_ERROR_BUSY;
+        goto end;
+    }
+    shm_dma_pool_release(&shm_table[kshm->id], task);
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief release the DMA pool buffers of a task in all the DMA pools
+ *
+ * Called at task exit, the task never accesses any SHM again.
+ */
+void mgr_mm_shm_dma_release_all(taskh_t task)
+{
+#if SHM_DMA_POOL_NUM > 0
+    for (size_t id = 0; id < SHM_LIST_SIZE; ++id) {
+        shm_dma_pool_release(&shm_table[id], task);
+    }
+#else
+    (void)task;
+#endif
+}
+
 /**
  * @fn get base address of the given SHM
  *
@@ -250,6 +741,41 @@ end:
     return status;
 }
 
+/**
+ * @brief specify if the given SHM is mapped as cacheable memory
+ *
+ * cacheability is defined in the DTS (outpost,cacheable property) and applies
+ * to both owner and user mappings. The secure boolean information is set
+ * through result argument
+ */
+kstatus_t mgr_mm_shm_is_cacheable(shmh_t shm, secure_bool_t *result)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely(result == NULL)) {
+        goto end;
+    }
+    /*@ assert \valid(result); */
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    *result = shm_table[kshm->id].meta->is_cacheable;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
 /**
  * @brief specify if the given SHM can be mapped by owner or user
  *
@@ -286,6 +812,12 @@ kstatus_t mgr_mm_shm_is_mappable_by(shmh_t shm, shm_user_t tsk, secure_bool_t *r
     /* otherwise, check for requester */
     if (tsk == SHM_TSK_OWNER) {
         *result = shm_table[kshm->id].owner.config.mappable;
+    } else if (SHM_TSK_IS_READER(tsk)) {
+        shm_user_state_t const *reader = shm_get_reader(&shm_table[kshm->id], tsk);
+        if (unlikely(reader == NULL)) {
+            goto end;
+        }
+        *result = reader->config.mappable;
     } else {
         *result = shm_table[kshm->id].user.config.mappable;
     }
@@ -361,8 +893,80 @@ kstatus_t mgr_mm_shm_is_writeable_by(shmh_t shm, shm_user_t accessor, secure_boo
             *result = shm_table[kshm->id].user.config.rw;
             break;
         default:
+            if (unlikely(shm_get_reader(&shm_table[kshm->id], accessor) == NULL)) {
+                goto end;
+            }
+            /* readers are always read-only */
+            *result = SECURE_FALSE;
+            break;
+    }
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief check that a task can access a SHM range through the kernel
+ *
+ * Used by syscalls accessing a SHM on behalf of a task (DMA copy, cache
+ * maintenance), out of the task MPU layout. The task must be allowed to
+ * map the SHM, so that the kernel never gives it access to data it could
+ * not reach by itself. Non-mappable DMA pools, holding kernel-built GPDMA
+ * linked-list tables, are always refused.
+ *
+ * @param[in] write: SECURE_TRUE if the range is written, requiring the write
+ *  permission on the SHM
+ * @param[out] base: start address of the range
+ *
+ * @return K_ERROR_INVPARAM if the SHM is invalid or not declared for the task,
+ *  or if the range exceeds the SHM, K_ERROR_DENIED if the task can't map the
+ *  SHM or write it when requested
+ */
+kstatus_t mgr_mm_shm_check_access(shmh_t shm, taskh_t task, size_t offset, size_t len,
+                                  secure_bool_t write, size_t *base)
+{
+    kstatus_t status;
+    shm_user_t accessor;
+    secure_bool_t result;
+    shm_meta_t const *meta;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(base == NULL)) {
+        status = K_ERROR_INVPARAM;
+        goto end;
+    }
+    if (unlikely((status = mgr_mm_shm_get_task_type(shm, task, &accessor)) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (unlikely(accessor == SHM_TSK_NONE)) {
+        status = K_ERROR_INVPARAM;
+        goto end;
+    }
+    /* handle checked by mgr_mm_shm_get_task_type() */
+    meta = shm_table[kshm->id].meta;
+    /* overflow-free range check */
+    if (unlikely((offset > meta->size) || (len > (meta->size - offset)))) {
+        status = K_ERROR_INVPARAM;
+        goto end;
+    }
+    if (unlikely((meta->is_dma_pool == SECURE_TRUE) && (meta->is_mappable != SECURE_TRUE))) {
+        status = K_ERROR_DENIED;
+        goto end;
+    }
+    status = mgr_mm_shm_is_mappable_by(shm, accessor, &result);
+    if (unlikely((status != K_STATUS_OKAY) || (result != SECURE_TRUE))) {
+        status = K_ERROR_DENIED;
+        goto end;
+    }
+    if (write == SECURE_TRUE) {
+        status = mgr_mm_shm_is_writeable_by(shm, accessor, &result);
+        if (unlikely((status != K_STATUS_OKAY) || (result != SECURE_TRUE))) {
+            status = K_ERROR_DENIED;
             goto end;
+        }
     }
+    *base = meta->baseaddr + offset;
     status = K_STATUS_OKAY;
 end:
     return status;
@@ -406,6 +1010,73 @@ end:
     return status;
 }
 
+/**
+ * @brief get the current user of the given SHM
+ *
+ * when the SHM is not shared, the user is the owner
+ */
+kstatus_t mgr_mm_shm_get_user(shmh_t shm, taskh_t *user)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely(user == NULL)) {
+        goto end;
+    }
+    /*@ assert \valid(user); */
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    *user = shm_table[kshm->id].user.task;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
+/**
+ * @brief specify if the given SHM user credentials can be transferred to another task
+ *
+ * the transferable credential is set by the owner (SHM_PERMISSION_TRANSFER) for
+ * the SHM user. The secure boolean information is set through result argument
+ */
+kstatus_t mgr_mm_shm_is_transferable(shmh_t shm, secure_bool_t *result)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    /*@ assert \valid_read(kshm); */
+
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely(result == NULL)) {
+        goto end;
+    }
+    /*@ assert \valid(result); */
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    *result = shm_table[kshm->id].user.config.transferable;
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
+
 /**
  * @brief specify if the given SHM is shared with another task
  *
@@ -468,8 +1139,14 @@ kstatus_t mgr_mm_shm_is_mapped_by(shmh_t shm, shm_user_t accessor, secure_bool_t
         case SHM_TSK_USER:
             *result = shm_table[kshm->id].user.is_mapped;
             break;
-        default:
-            goto end;
+        default: {
+            shm_user_state_t const *reader = shm_get_reader(&shm_table[kshm->id], accessor);
+            if (unlikely(reader == NULL)) {
+                goto end;
+            }
+            *result = reader->is_mapped;
+            break;
+        }
     }
     status = K_STATUS_OKAY;
 end:
@@ -501,8 +1178,14 @@ kstatus_t mgr_mm_shm_set_mapflag(shmh_t shm, shm_user_t accessor, secure_bool_t
         case SHM_TSK_USER:
             shm_table[kshm->id].user.is_mapped = mapflag;
             break;
-        default:
-            goto end;
+        default: {
+            shm_user_state_t *reader = shm_get_reader(&shm_table[kshm->id], accessor);
+            if (unlikely(reader == NULL)) {
+                goto end;
+            }
+            reader->is_mapped = mapflag;
+            break;
+        }
     }
     status = K_STATUS_OKAY;
 end:
@@ -606,3 +1289,115 @@ kstatus_t mgr_mm_shm_configure(shmh_t shm, shm_user_t target, shm_config_t const
 end:
     return status;
 }
+
+/**
+ * @brief handle a ring-mode SHM doorbell, deciding if the peer must be woken up
+ *
+ * The producer is the SHM owner, the consumer is the SHM user. When the SHM is
+ * not shared, the owner is both. Only the ring indexes are read from the SHM
+ * and are checked against the kernel-side ring capacity.
+ *
+ * The consumer is woken up when the ring leaves the empty state, or when the
+ * fill level crosses the DTS defined watermark. The producer is woken up when
+ * the ring leaves the full state.
+ *
+ * @param[in] shm: ring SHM handle
+ * @param[in] accessor: caller type for this SHM (owner or user)
+ * @param[in] event: doorbell event (ShmRingEvent)
+ * @param[out] peer: task to wake up
+ * @param[out] wake: SECURE_TRUE if peer must be woken up
+ *
+ * @return K_ERROR_NOENT if the SHM is not a ring, K_ERROR_DENIED if the caller
+ *  is not the event emitter, K_SECURITY_INTEGRITY if the ring indexes are
+ *  corrupted
+ */
+kstatus_t mgr_mm_shm_ring_doorbell(shmh_t shm, shm_user_t accessor, uint32_t event,
+                                   taskh_t *peer, secure_bool_t *wake)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    kshmh_t const *kshm = shmh_to_kshmh(&shm);
+    volatile shm_ring_t const *ring;
+    shm_info_t *info;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t fill;
+    uint32_t old_fill;
+
+    /*@ assert \valid_read(kshm); */
+    if (unlikely(mgr_mm_configured() == SECURE_FALSE)) {
+        status = K_ERROR_BADSTATE;
+        goto end;
+    }
+    if (unlikely((peer == NULL) || (wake == NULL))) {
+        goto end;
+    }
+    /* check that id exsits */
+    if (unlikely(kshm->id >= SHM_LIST_SIZE)) {
+        goto end;
+    }
+    /* check that handle matches */
+    if (unlikely(shm_table[kshm->id].handle != shm)) {
+        goto end;
+    }
+    info = &shm_table[kshm->id];
+    if (unlikely(info->meta->is_ring != SECURE_TRUE)) {
+        status = K_ERROR_NOENT;
+        goto end;
+    }
+    ring = (volatile shm_ring_t const *)info->meta->baseaddr;
+    /* indexes are read once, the task may update them concurrently */
+    head = ring->head;
+    tail = ring->tail;
+    fill = head - tail;
+    if (unlikely(fill > info->ring_capacity)) {
+        status = K_SECURITY_INTEGRITY;
+        goto end;
+    }
+    *wake = SECURE_FALSE;
+    switch (event) {
+        case SHM_RING_PRODUCED:
+            /* when unshared, get_task_type() returns owner for the owner */
+            if (unlikely(accessor != SHM_TSK_OWNER)) {
+                status = K_ERROR_DENIED;
+                goto end;
+            }
+            /* the consumer may have already popped beyond the previous head */
+            old_fill = 0;
+            if ((int32_t)(info->ring_head - tail) > 0) {
+                old_fill = info->ring_head - tail;
+            }
+            if (fill != 0) {
+                if (old_fill == 0) {
+                    /* empty to non-empty */
+                    *wake = SECURE_TRUE;
+                } else if ((info->meta->ring_watermark != 0) &&
+                           (old_fill < info->meta->ring_watermark) &&
+                           (fill >= info->meta->ring_watermark)) {
+                    /* watermark crossed */
+                    *wake = SECURE_TRUE;
+                }
+            }
+            info->ring_head = head;
+            *peer = info->user.task;
+            break;
+        case SHM_RING_CONSUMED:
+            if (unlikely((accessor != SHM_TSK_USER) &&
+                         !((accessor == SHM_TSK_OWNER) && (info->is_shared == SECURE_FALSE)))) {
+                status = K_ERROR_DENIED;
+                goto end;
+            }
+            /* the ring was full at the previous consumer doorbell, or has been
+             * filled since then: the producer may wait for room */
+            if (((head - info->ring_tail) >= info->ring_capacity) && (fill < info->ring_capacity)) {
+                *wake = SECURE_TRUE;
+            }
+            info->ring_tail = tail;
+            *peer = info->owner.task;
+            break;
+        default:
+            goto end;
+    }
+    status = K_STATUS_OKAY;
+end:
+    return status;
+}
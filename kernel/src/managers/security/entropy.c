@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <stddef.h>
+#include <string.h>
 #if defined(CONFIG_SECURITY_HW_ENTROPY)
 #include <bsp/drivers/rng/rng.h>
 #endif
+#if CONFIG_CRC32_HW_STM32
+#include <bsp/drivers/crc/crc.h>
+#endif
 #include <sentry/zlib/crypto.h>
 #include <sentry/ktypes.h>
 #include <sentry/managers/debug.h>
@@ -15,6 +19,106 @@ static uint32_t seed;
  * @file Entropy source management
  */
 
+#if CONFIG_SECURITY_DRBG
+#define DRBG_KEY_WORDS   8
+#define DRBG_NONCE_WORDS 3
+#define DRBG_BLOCK_WORDS 16
+
+/**
+ * ChaCha20 DRBG context
+ *
+ * Each ChaCha20 block is split in two: the first half is the key of the next
+ * block (fast key erasure), the second half is the random output. The key
+ * half is wiped as soon as it is copied, and each output word is wiped when
+ * delivered, so that the context never holds already delivered values.
+ */
+typedef struct drbg_context {
+    uint32_t key[DRBG_KEY_WORDS];
+    uint32_t nonce[DRBG_NONCE_WORDS];
+    uint32_t counter;
+    uint32_t block[DRBG_BLOCK_WORDS];
+    uint32_t idx;           /**< next output word of block, DRBG_BLOCK_WORDS if empty */
+    uint32_t blocks;        /**< blocks generated since last reseed */
+} drbg_context_t;
+
+static drbg_context_t drbg;
+#endif
+
+/**
+ * @brief get a 32 bits value from the entropy source (TRNG or PGC32)
+ */
+static inline kstatus_t entropy_source_get(uint32_t *val)
+{
+#if CONFIG_SECURITY_HW_ENTROPY
+    return rng_get(val);
+#else
+    *val = pcg32();
+    return K_STATUS_OKAY;
+#endif
+}
+
+#if CONFIG_SECURITY_DRBG
+/**
+ * @brief mix new entropy source values into the DRBG key
+ */
+static kstatus_t drbg_reseed(void)
+{
+    kstatus_t status = K_STATUS_OKAY;
+    uint32_t val;
+
+    for (uint8_t i = 0; i < DRBG_KEY_WORDS; ++i) {
+        if (unlikely((status = entropy_source_get(&val)) != K_STATUS_OKAY)) {
+            goto end;
+        }
+        drbg.key[i] ^= val;
+    }
+    drbg.blocks = 0;
+end:
+    return status;
+}
+
+/**
+ * @brief generate a new DRBG block, reseeding the key when needed
+ */
+static kstatus_t drbg_refill(void)
+{
+    kstatus_t status = K_STATUS_OKAY;
+
+    if (unlikely(drbg.blocks >= CONFIG_SECURITY_DRBG_RESEED_INTERVAL)) {
+        if (unlikely((status = drbg_reseed()) != K_STATUS_OKAY)) {
+            goto end;
+        }
+    }
+    chacha20_block(drbg.block, drbg.key, drbg.counter, drbg.nonce);
+    drbg.counter++;
+    drbg.blocks++;
+    memcpy(drbg.key, &drbg.block[0], sizeof(drbg.key));
+    memset(&drbg.block[0], 0x0, sizeof(drbg.key));
+    drbg.idx = DRBG_KEY_WORDS;
+end:
+    return status;
+}
+
+/**
+ * @brief seed the DRBG from the entropy source
+ */
+static kstatus_t drbg_init(void)
+{
+    kstatus_t status = K_STATUS_OKAY;
+
+    for (uint8_t i = 0; i < DRBG_NONCE_WORDS; ++i) {
+        if (unlikely((status = entropy_source_get(&drbg.nonce[i])) != K_STATUS_OKAY)) {
+            goto end;
+        }
+    }
+    drbg.counter = 0;
+    drbg.idx = DRBG_BLOCK_WORDS;
+    status = drbg_reseed();
+end:
+    return status;
+}
+#endif
+
  /**
   * @brief initialize Sentry entropy source
   *
@@ -37,8 +141,17 @@ kstatus_t mgr_security_entropy_init(void)
      */
     seed = pcg32();
     status = K_STATUS_OKAY;
+#if CONFIG_SECURITY_DRBG
+    status = drbg_init();
+#endif
 #else
     pr_info("HW RNG supported, initializing HW entropy backend...");
+#if CONFIG_CRC32_HW_STM32
+    /* CRC unit used for bulk crc32() input, software CRC32 is kept otherwise */
+    if (unlikely(crc_probe() != K_STATUS_OKAY)) {
+        pr_warn("CRC unit probe failed, using software CRC32");
+    }
+#endif
     status = rng_probe();
     if (unlikely(status != K_STATUS_OKAY)) {
         goto end;
@@ -48,6 +161,13 @@ kstatus_t mgr_security_entropy_init(void)
         pr_err("failed ro initialize RNG! status=%u", status);
         goto end;
     }
+#if CONFIG_SECURITY_DRBG
+    status = drbg_init();
+    if (unlikely(status != K_STATUS_OKAY)) {
+        pr_err("failed to seed DRBG! status=%u", status);
+        goto end;
+    }
+#endif
     pr_info("RNG init done.");
     status = K_STATUS_OKAY;
 end:
@@ -58,6 +178,8 @@ end:
 /**
   * @brief generate a new random value from the initialized entropy source
   *
+  * With CONFIG_SECURITY_DRBG, the value is delivered by the DRBG, the entropy
+  * source being only requested at reseed time.
   */
 kstatus_t mgr_security_entropy_generate(uint32_t *seed)
 {
@@ -65,12 +187,71 @@ kstatus_t mgr_security_entropy_generate(uint32_t *seed)
     if (unlikely(seed == NULL)) {
         goto end;
     }
-#if CONFIG_SECURITY_HW_ENTROPY
-    status = rng_get(seed);
+#if CONFIG_SECURITY_DRBG
+    if (drbg.idx >= DRBG_BLOCK_WORDS) {
+        if (unlikely((status = drbg_refill()) != K_STATUS_OKAY)) {
+            goto end;
+        }
+    }
+    *seed = drbg.block[drbg.idx];
+    drbg.block[drbg.idx] = 0;
+    drbg.idx++;
+    status = K_STATUS_OKAY;
 #else
-    *seed = pcg32();
+    status = entropy_source_get(seed);
+#endif
+end:
+    return status;
+}
+
+/**
+  * @brief fill the given buffer with random values
+  *
+  * Bulk variant of mgr_security_entropy_generate(). With CONFIG_SECURITY_DRBG,
+  * DRBG blocks are copied by chunks, otherwise one entropy source request is
+  * made per 32 bits word.
+  *
+  * @param buf buffer to fill, no alignment required
+  * @param len buffer length in bytes
+  *
+  * @return K_ERROR_INVPARAM if buf is NULL, the entropy source error if any,
+  *   K_STATUS_OKAY otherwise
+  */
+kstatus_t mgr_security_entropy_fill(uint8_t *buf, size_t len)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    size_t chunk;
+
+    if (unlikely(buf == NULL)) {
+        goto end;
+    }
     status = K_STATUS_OKAY;
+    while (len > 0) {
+#if CONFIG_SECURITY_DRBG
+        if (drbg.idx >= DRBG_BLOCK_WORDS) {
+            if (unlikely((status = drbg_refill()) != K_STATUS_OKAY)) {
+                goto end;
+            }
+        }
+        chunk = (DRBG_BLOCK_WORDS - drbg.idx) * sizeof(uint32_t);
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(buf, &drbg.block[drbg.idx], chunk);
+        /* a partially delivered word is wiped and dropped too */
+        memset(&drbg.block[drbg.idx], 0x0, chunk);
+        drbg.idx += (chunk + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+#else
+        uint32_t val;
+        if (unlikely((status = entropy_source_get(&val)) != K_STATUS_OKAY)) {
+            goto end;
+        }
+        chunk = (len < sizeof(uint32_t)) ? len : sizeof(uint32_t);
+        memcpy(buf, &val, chunk);
 #endif
+        buf += chunk;
+        len -= chunk;
+    }
 end:
     return status;
 }
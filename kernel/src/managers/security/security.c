@@ -117,6 +117,7 @@ kstatus_t mgr_security_autotest(void)
     uint64_t max = 0;
     uint64_t average = 0;
     uint32_t failures = 0;
+    uint8_t bulk[256];
     pr_autotest("START execute 256 entropy generation from entropy source");
     /* executing 256 random seed requests */
     for (uint32_t i=0; i < 256; ++i) {
@@ -139,6 +140,13 @@ kstatus_t mgr_security_autotest(void)
     pr_autotest("entropy_generate min time: %llu", min);
     pr_autotest("entropy_generate max time: %llu", max);
     pr_autotest("entropy_generate average time: %llu", average);
+    /* bulk generation, as used by sys_get_random_buffer() */
+    start = systime_get_cycle();
+    if (unlikely(mgr_security_entropy_fill(bulk, sizeof(bulk)) != K_STATUS_OKAY)) {
+        failures++;
+    }
+    stop = systime_get_cycle();
+    pr_autotest("entropy_fill %u bytes time: %llu", (uint32_t)sizeof(bulk), stop - start);
     pr_autotest("entropy_generate failures: %llu", failures);
     pr_autotest("END");
 
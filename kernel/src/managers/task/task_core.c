@@ -16,6 +16,7 @@
 #include <sentry/managers/task.h>
 #include <sentry/managers/debug.h>
 #include <sentry/managers/memory.h>
+#include <sentry/managers/dma.h>
 #include <sentry/zlib/math.h>
 #include <sentry/sched.h>
 #include "task_init.h"
@@ -423,7 +424,7 @@ kstatus_t task_set_job_layout(task_t * const tsk)
         /** TODO: the memsetting proof can be added easily through the usage of dts-based autotest memory layout,
          * so that a ghost function can validate that bss init is made on a valid range
          */
-        memcpy((void*)got_start, (void*)got_source, meta->got_size);
+        mgr_dma_memcpy((void*)got_start, (void*)got_source, meta->got_size);
     #endif
     }
     /* copy data segment if non null */
@@ -439,7 +440,7 @@ kstatus_t task_set_job_layout(task_t * const tsk)
         /** TODO: the memsetting proof can be added easily through the usage of dts-based autotest memory layout,
          * so that a ghost function can validate that bss init is made on a valid range
          */
-        memcpy((void*)data_start, (void*)data_source, meta->data_size);
+        mgr_dma_memcpy((void*)data_start, (void*)data_source, meta->data_size);
     #endif
     }
     /* zeroify bss if non-null */
@@ -453,7 +454,7 @@ kstatus_t task_set_job_layout(task_t * const tsk)
         /** TODO: the memsetting proof can be added easily through the usage of dts-based autotest memory layout,
          * so that a ghost function can validate that bss init is made on a valid range
          */
-        memset((void*)bss_start, 0x0, meta->bss_size);
+        mgr_dma_memzero((void*)bss_start, meta->bss_size);
 #endif
     }
     /* zeroify SVC Exchange */
@@ -528,6 +529,27 @@ err:
     return status;
 }
 
+/**
+ * @brief cancel an IPC event pushed by source to dest and not yet loaded
+ *
+ * Used when the syscall emitting the IPC fails after the event push. The
+ * source is blocked until its IPC is read, so its slot was empty before.
+ */
+kstatus_t mgr_task_cancel_ipc_event(taskh_t source, taskh_t dest)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    task_t * tsk = task_get_from_handle(dest);
+
+    if (unlikely(tsk == NULL)) {
+        goto err;
+    }
+    const ktaskh_t *ksrc = taskh_to_ktaskh(&source);
+    tsk->ipcs[ksrc->id] = 0;
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+
 #if CONFIG_BUILD_TARGET_AUTOTEST
 static uint8_t autotest_exchangebuf[CONFIG_SVC_EXCHANGE_AREA_LEN];
 #endif
@@ -778,6 +800,9 @@ kstatus_t mgr_task_add_resource(taskh_t t, uint8_t resource_id, layout_resource_
     }
 
     memcpy(&cell->layout[resource_id], &resource, sizeof(layout_resource_t));
+#if CONFIG_MM_REGION_CACHE
+    cell->layout_stamp[resource_id] = ++cell->layout_clock;
+#endif
     status = K_STATUS_OKAY;
 err:
     return status;
@@ -800,6 +825,107 @@ err:
     return status;
 }
 
+#if CONFIG_MM_REGION_CACHE
+kstatus_t mgr_task_add_overflow_resource(taskh_t t, layout_resource_t resource)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    task_t *cell;
+
+    if (unlikely((cell = task_get_from_handle(t)) == NULL)) {
+        goto err;
+    }
+    status = K_ERROR_BUSY;
+    for (uint8_t i = 0; i < CONFIG_MM_REGION_CACHE_DEPTH; ++i) {
+        if (__mpu_is_resource_free(&cell->overflow[i]) == SECURE_TRUE) {
+            memcpy(&cell->overflow[i], &resource, sizeof(layout_resource_t));
+            status = K_STATUS_OKAY;
+            break;
+        }
+    }
+err:
+    return status;
+}
+
+kstatus_t mgr_task_remove_overflow_resource(taskh_t t, uint32_t addr)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    task_t *cell;
+
+    if (unlikely((cell = task_get_from_handle(t)) == NULL)) {
+        goto err;
+    }
+    status = K_ERROR_NOENT;
+    for (uint8_t i = 0; i < CONFIG_MM_REGION_CACHE_DEPTH; ++i) {
+        if ((__mpu_is_resource_free(&cell->overflow[i]) == SECURE_FALSE) &&
+            (__mpu_get_resource_base_address(&cell->overflow[i]) == addr)) {
+            /* zeroed resource is free on all MPU backends */
+            memset(&cell->overflow[i], 0x0, sizeof(layout_resource_t));
+            status = K_STATUS_OKAY;
+            break;
+        }
+    }
+err:
+    return status;
+}
+
+/**
+ * @brief software MPU region cache refill
+ *
+ * The overflow resource mapping addr is swapped with a free layout slot if any, or
+ * with the least recently loaded device or SHM slot otherwise. Task text and data
+ * slots are never replaced. As long as at least two slots are replaceable, the
+ * resource loaded by the previous refill is never the one replaced, so that an
+ * instruction accessing two resources can always complete.
+ * The MPU is reloaded with the task layout at kernel handler exit.
+ */
+kstatus_t mgr_task_refill_resource(taskh_t t, uint32_t addr)
+{
+    kstatus_t status = K_ERROR_INVPARAM;
+    task_t *cell;
+    layout_resource_t victim;
+    uint8_t first = mgr_mm_region_to_layout_id(MM_REGION_TASK_RESSOURCE_DEVICE);
+    uint8_t entry = CONFIG_MM_REGION_CACHE_DEPTH;
+    uint8_t slot = first;
+
+    if (unlikely((cell = task_get_from_handle(t)) == NULL)) {
+        goto err;
+    }
+    for (uint8_t i = 0; i < CONFIG_MM_REGION_CACHE_DEPTH; ++i) {
+        if ((__mpu_is_resource_free(&cell->overflow[i]) == SECURE_FALSE) &&
+            (__mpu_resource_contains(&cell->overflow[i], addr) == SECURE_TRUE)) {
+            entry = i;
+            break;
+        }
+    }
+    if (entry == CONFIG_MM_REGION_CACHE_DEPTH) {
+        /* not a granted resource, real fault */
+        status = K_ERROR_NOENT;
+        goto err;
+    }
+    for (uint8_t i = first; i < TASK_MAX_RESSOURCES_NUM; ++i) {
+        if (__mpu_is_resource_free(&cell->layout[i]) == SECURE_TRUE) {
+            slot = i;
+            break;
+        }
+        if (cell->layout_stamp[i] < cell->layout_stamp[slot]) {
+            slot = i;
+        }
+    }
+    memcpy(&victim, &cell->layout[slot], sizeof(layout_resource_t));
+    memcpy(&cell->layout[slot], &cell->overflow[entry], sizeof(layout_resource_t));
+    __mpu_resource_set_region(&cell->layout[slot], mgr_mm_layout_to_region_id(slot));
+    if (__mpu_is_resource_free(&victim) == SECURE_TRUE) {
+        memset(&cell->overflow[entry], 0x0, sizeof(layout_resource_t));
+    } else {
+        memcpy(&cell->overflow[entry], &victim, sizeof(layout_resource_t));
+    }
+    cell->layout_stamp[slot] = ++cell->layout_clock;
+    status = K_STATUS_OKAY;
+err:
+    return status;
+}
+#endif
+
 kstatus_t mgr_task_get_layout_from_handle(taskh_t t,
                                           const layout_resource_t **layout)
 {
@@ -71,6 +71,14 @@ typedef struct  task {
     */
     layout_resource_t layout[TASK_MAX_RESSOURCES_NUM];
     uint32_t num_ressources; /* number of ressources, including txt and data */
+#if CONFIG_MM_REGION_CACHE
+    /** mapped resources not currently in the layout, loaded at first access.
+       CAUTION: this field is size-impacting in kernel RAM !
+    */
+    layout_resource_t overflow[CONFIG_MM_REGION_CACHE_DEPTH];
+    uint32_t layout_stamp[TASK_MAX_RESSOURCES_NUM]; /**< layout slots load date, for replacement */
+    uint32_t layout_clock; /**< layout load date counter */
+#endif
     const task_meta_t *metadata; /**< task metadata (const, build-time, informations) */
     /*
      * Task context information, these fields store dynamic values, such as current
@@ -469,6 +469,17 @@ static inline kstatus_t task_init_finalize(void)
     /* idle is not scheduled, it is instead a fallback of all schedulers, using its handler
      * at election time only
      */
+#if CONFIG_MM_KINFO_PAGE
+    /* all handles are known, map and fill the kernel information page */
+    for (uint16_t i = 0; i < ctx.numtask; ++i) {
+        const taskh_t *handle = ktaskh_to_taskh(&task_table[i].handle);
+        layout_resource_t ressource;
+
+        mgr_mm_forge_ressource(MM_REGION_TASK_KINFO, *handle, &ressource);
+        mgr_task_add_resource(*handle, mgr_mm_region_to_layout_id(MM_REGION_TASK_KINFO), ressource);
+        mgr_mm_kinfo_add_task(task_table[i].metadata->label, *handle);
+    }
+#endif
     pr_info("found a total of %u tasks, including idle", ctx.numtask);
     ctx.status = K_STATUS_OKAY;
     ctx.state = TASK_MANAGER_STATE_READY;
@@ -5,6 +5,7 @@
 #include <uapi/handle.h>
 #include <sentry/ktypes.h>
 #include <sentry/arch/asm-generic/membarriers.h>
+#include <sentry/arch/asm-generic/interrupt.h>
 #include <sentry/managers/debug.h>
 #include <sentry/sched.h>
 
@@ -24,6 +25,9 @@ typedef struct sched_fifo_context {
     uint16_t    end_of_queue;  /**< end of the RB */
     bool        empty;         /**< RB empty flag */
     taskh_t     current; /* current can be one of tasks_queue user task, or idle */
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    bool        resched;       /**< deferred election requested, not yet executed */
+#endif
  } sched_fifo_context_t;
 
 static sched_fifo_context_t sched_fifo_ctx;
@@ -121,12 +125,43 @@ taskh_t sched_fifo_elect(void)
         .id = SCHED_IDLE_TASK_LABEL,
         .family = HANDLE_TASKID,
     };
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    /* any election consumes the pending deferred request */
+    sched_fifo_ctx.resched = false;
+#endif
     if (likely(sched_fifo_ctx.empty == false)) {
         tsk = sched_fifo_dequeue_task();
     }
     return tsk;
 }
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+void sched_fifo_request_preempt(void)
+{
+    sched_fifo_ctx.resched = true;
+    interrupt_request_context_switch();
+}
+
+/*
+ * FIFO jobs are never preempted, they are executed until they block. Only
+ * the idle task leaves the core at PendSV time.
+ */
+taskh_t sched_fifo_preempt(void)
+{
+    taskh_t tsk = sched_fifo_ctx.current;
+
+    if (unlikely(sched_fifo_ctx.resched == false)) {
+        goto end;
+    }
+    sched_fifo_ctx.resched = false;
+    if (mgr_task_is_idletask(tsk) == SECURE_TRUE) {
+        tsk = sched_fifo_elect();
+    }
+end:
+    return tsk;
+}
+#endif
+
 taskh_t sched_fifo_get_current(void)
 {
     return sched_fifo_ctx.current;
@@ -162,6 +197,10 @@ kstatus_t sched_schedule(taskh_t t) __attribute__((alias("sched_fifo_schedule"))
 taskh_t sched_elect(void) __attribute__((alias("sched_fifo_elect")));
 taskh_t sched_get_current(void) __attribute__((alias("sched_fifo_get_current")));
 kstatus_t sched_init(void) __attribute__((alias("sched_fifo_init")));
+#if CONFIG_SCHED_DEFERRED_SWITCH
+void sched_request_preempt(void) __attribute__((alias("sched_fifo_request_preempt")));
+taskh_t sched_preempt(void) __attribute__((alias("sched_fifo_preempt")));
+#endif
 #ifdef CONFIG_BUILD_TARGET_AUTOTEST
 kstatus_t sched_autotest(void) __attribute__((alias("sched_fifo_autotest")));
 #endif
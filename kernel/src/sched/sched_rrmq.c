@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <sentry/arch/asm-generic/panic.h>
+#include <sentry/arch/asm-generic/interrupt.h>
 #include <uapi/handle.h>
 #include <sentry/ktypes.h>
 #include <sentry/managers/debug.h>
@@ -72,6 +73,9 @@ typedef struct sched_rrmq_context {
     task_rrmq_jobset_t   *active_jobset;   /**< current jobset */
     task_rrmq_jobset_t   *backed_jobset;   /**< backed (next timeslot) jobset */
     task_rrmq_state_t    *current_job;     /**< current task that is being executed, or idle */
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    bool                  resched;         /**< deferred election requested, not yet executed */
+#endif
  } sched_rrmq_context_t;
 
 static sched_rrmq_context_t
@@ -178,6 +182,25 @@ kstatus_t sched_rrmq_schedule(taskh_t t)
     return status;
 }
 
+/*
+ * highest priority job of the active jobset. On equal priorities, the given
+ * job, if any, is kept, otherwise the first one in the jobset is returned.
+ */
+static task_rrmq_state_t *sched_rrmq_highest(task_rrmq_state_t *next)
+{
+    for (uint8_t i = 0; i < CONFIG_MAX_TASKS; ++i) {
+        if (sched_rrmq_ctx.active_jobset->joblist[i].active == true) {
+            if (next == NULL) {
+                next = &sched_rrmq_ctx.active_jobset->joblist[i];
+            }
+            if (sched_rrmq_ctx.active_jobset->joblist[i].priority > next->priority) {
+                next = &sched_rrmq_ctx.active_jobset->joblist[i];
+            }
+        }
+    }
+    return next;
+}
+
 /*
  * call context: SVC and systick. For SVC case: use task_mgr_set_state() first,
  * as the current task state may depend on the current syscall, and thus may
@@ -188,6 +211,10 @@ taskh_t sched_rrmq_elect(void)
     /* defaulting on idle */
     taskh_t tsk = mgr_task_get_idle();
     job_state_t state;
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    /* any election consumes the pending deferred request */
+    sched_rrmq_ctx.resched = false;
+#endif
     if (unlikely(sched_rrmq_ctx.current_job == NULL)) {
         /* this case happen only when elect() is called by idle while there is
          * absolutely NO active job. This is an extreme case, where we
@@ -226,17 +253,7 @@ elect:
     }
     /* there is at least one task eligible in current task set */
     /* RRM scheduling here */
-    task_rrmq_state_t *next = NULL;
-    for (uint8_t i = 0; i < CONFIG_MAX_TASKS; ++i) {
-        if (sched_rrmq_ctx.active_jobset->joblist[i].active == true) {
-            if (next == NULL) {
-                next = &sched_rrmq_ctx.active_jobset->joblist[i];
-            }
-            if (sched_rrmq_ctx.active_jobset->joblist[i].priority > next->priority) {
-                next = &sched_rrmq_ctx.active_jobset->joblist[i];
-            }
-        }
-    }
+    task_rrmq_state_t *next = sched_rrmq_highest(NULL);
     if (unlikely(next == NULL)) {
         sched_rrmq_ctx.current_job = NULL;
         goto end;
@@ -259,6 +276,49 @@ taskh_t sched_rrmq_get_current(void)
     return tsk;
 }
 
+#if CONFIG_SCHED_DEFERRED_SWITCH
+/* call context: asynchronous handlers (systick, user interrupts) */
+void sched_rrmq_request_preempt(void)
+{
+    sched_rrmq_ctx.resched = true;
+    interrupt_request_context_switch();
+}
+
+/*
+ * call context: PendSV. A job preempted by a higher priority one stays in the
+ * active jobset with its remaining quantum. A job that has consumed its quantum
+ * goes through the nominal election, and is pushed to the backed jobset.
+ */
+taskh_t sched_rrmq_preempt(void)
+{
+    taskh_t tsk = sched_rrmq_get_current();
+    job_state_t state;
+
+    if (unlikely(sched_rrmq_ctx.resched == false)) {
+        /* request already consumed by a synchronous election, nothing to do */
+        goto end;
+    }
+    if ((sched_rrmq_ctx.current_job == NULL) ||
+        (sched_rrmq_ctx.current_job->quantum == 0)) {
+        tsk = sched_rrmq_elect();
+        goto end;
+    }
+    if (unlikely(mgr_task_get_state(sched_rrmq_ctx.current_job->handler, &state) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    if (unlikely(state != JOB_STATE_READY)) {
+        tsk = sched_rrmq_elect();
+        goto end;
+    }
+    sched_rrmq_ctx.resched = false;
+    /* current job is in the active jobset, and kept on equal priorities */
+    sched_rrmq_ctx.current_job = sched_rrmq_highest(sched_rrmq_ctx.current_job);
+    tsk = sched_rrmq_ctx.current_job->handler;
+end:
+    return tsk;
+}
+#endif
+
 /* call context: HW ticker IRQn */
 stack_frame_t *sched_rrmq_refresh(stack_frame_t *frame)
 {
@@ -267,14 +327,25 @@ stack_frame_t *sched_rrmq_refresh(stack_frame_t *frame)
         /* no task as never been scheduled() nor elected() */
         goto end;
     }
+#if CONFIG_SCHED_DEFERRED_SWITCH
+    if (unlikely(sched_rrmq_ctx.current_job->quantum == 0)) {
+        /* election already requested, PendSV not yet executed */
+        goto end;
+    }
+#endif
     sched_rrmq_ctx.current_job->quantum--;
     if (unlikely(sched_rrmq_ctx.current_job->quantum == 0)) {
+#if CONFIG_SCHED_DEFERRED_SWITCH
+        /* quantum terminated: election deferred to PendSV, frame unchanged */
+        sched_rrmq_request_preempt();
+#else
         /* quantum terminated: election required */
         taskh_t tsk = sched_rrmq_elect();
         /* context switching */
         if (unlikely(mgr_task_get_sp(tsk, &out_frame) != K_STATUS_OKAY)) {
             panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
         }
+#endif
     }
 end:
     return out_frame;
@@ -296,6 +367,10 @@ taskh_t sched_elect(void) __attribute__((alias("sched_rrmq_elect")));
 taskh_t sched_get_current(void) __attribute__((alias("sched_rrmq_get_current")));
 kstatus_t sched_init(void) __attribute__((alias("sched_rrmq_init")));
 stack_frame_t *sched_refresh(stack_frame_t *frame) __attribute__((alias("sched_rrmq_refresh")));
+#if CONFIG_SCHED_DEFERRED_SWITCH
+void sched_request_preempt(void) __attribute__((alias("sched_rrmq_request_preempt")));
+taskh_t sched_preempt(void) __attribute__((alias("sched_rrmq_preempt")));
+#endif
 #ifdef CONFIG_BUILD_TARGET_AUTOTEST
 kstatus_t sched_autotest(void) __attribute__((alias("sched_rrmq_autotest")));
 #endif
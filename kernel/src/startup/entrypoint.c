@@ -66,6 +66,12 @@ __attribute__((noreturn)) void _entrypoint(void)
     if (unlikely(mgr_time_init() != K_STATUS_OKAY)) {
         panic(PANIC_HARDWARE_INVALID_STATE);
     }
+#if CONFIG_DMA_KERNEL_MEMCPY
+    /* kernel memory copy channel, used for tasks sections init */
+    if (unlikely(mgr_dma_kernel_copy_init() != K_STATUS_OKAY)) {
+        panic(PANIC_HARDWARE_INVALID_STATE);
+    }
+#endif
     /* tasks initialization (probing) */
     if (unlikely(mgr_task_init() != K_STATUS_OKAY)) {
         panic(PANIC_CONFIGURATION_MISMATCH);
@@ -87,6 +93,10 @@ __attribute__((noreturn)) void _entrypoint(void)
     platform_init();
     pr_autotest("INFO: init finished");
     pr_debug("starting userspace");
+#if CONFIG_DEBUG_USART_ASYNC
+    /* from now on, logs are drained by the USART interrupt */
+    mgr_debug_async_start();
+#endif
     mgr_task_start();
     __builtin_unreachable();
     /* This part of the function is never reached */
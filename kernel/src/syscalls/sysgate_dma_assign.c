@@ -15,7 +15,7 @@ stack_frame_t *gate_dma_assign(stack_frame_t *frame, dmah_t dmah)
     Status sysret = STATUS_NO_ENTITY;
 #ifdef CONFIG_HAS_GPDMA
     taskh_t owner;
-    gpdma_stream_cfg_t const * kinfo = NULL;
+    kstatus_t status;
 
     if (unlikely(mgr_dma_get_owner(dmah, &owner) != K_STATUS_OKAY)) {
         sysret = STATUS_INVALID;
@@ -29,7 +29,13 @@ stack_frame_t *gate_dma_assign(stack_frame_t *frame, dmah_t dmah)
         mgr_task_set_sysreturn(current, STATUS_DENIED);
         goto end;
     }
-    if (unlikely(mgr_dma_stream_assign(dmah) != K_STATUS_OKAY)) {
+    status = mgr_dma_stream_assign(dmah);
+    if (unlikely(status == K_ERROR_BUSY)) {
+        /* no free channel, another stream must be unassigned first */
+        sysret = STATUS_BUSY;
+        goto end;
+    }
+    if (unlikely(status != K_STATUS_OKAY)) {
         sysret = STATUS_INVALID;
         goto end;
     }
@@ -4,6 +4,7 @@
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/device.h>
+#include <sentry/managers/memory.h>
 #include <sentry/sched.h>
 #include <sentry/arch/asm-generic/panic.h>
 
@@ -32,6 +33,8 @@ stack_frame_t *gate_exit(const stack_frame_t *frame, uint32_t result)
      * code value is set to NON_SENSE, generating a voluntary panic() if elected again
      */
     mgr_task_set_sysreturn(current, STATUS_NON_SENSE);
+    /* the job never accesses its SHMs again, its DMA pool buffers are released */
+    mgr_mm_shm_dma_release_all(current);
     /* now electing a new job, sched_elect() never fails */
     next = sched_elect();
     if (unlikely(mgr_task_get_sp(next, &next_frame) != K_STATUS_OKAY)) {
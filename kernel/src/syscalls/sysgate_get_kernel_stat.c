@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <uapi/types.h>
+#include <sentry/managers/task.h>
+#include <sentry/managers/security.h>
+#include <sentry/managers/debug.h>
+#include <sentry/arch/asm-generic/panic.h>
+#include <sentry/sched.h>
+/** NOTE: memcpy impleted in Sentry zlib */
+#include <string.h>
+
+stack_frame_t *gate_get_kernel_stat(stack_frame_t *frame, uint32_t stat, uint32_t index)
+{
+    taskh_t current = sched_get_current();
+    kernel_stat_infos_t infos = {0};
+    kernel_stat_infos_t *svcexch;
+    const task_meta_t *meta;
+
+    if (unlikely(mgr_security_has_capa(current, CAP_SYS_DEBUG) != SECURE_TRUE)) {
+        mgr_task_set_sysreturn(current, STATUS_DENIED);
+        goto end;
+    }
+    if (unlikely(mgr_debug_kstat_get(stat, index, &infos) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_NO_ENTITY);
+        goto end;
+    }
+    if (unlikely(mgr_task_get_metadata(current, &meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    svcexch = (kernel_stat_infos_t*)meta->s_svcexchange;
+    memcpy(svcexch, &infos, sizeof(kernel_stat_infos_t));
+    mgr_task_set_sysreturn(current, STATUS_OK);
+end:
+    return frame;
+}
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <sentry/managers/task.h>
+#include <sentry/managers/memory.h>
+#include <sentry/arch/asm-generic/panic.h>
+#include <sentry/sched.h>
+
+stack_frame_t *gate_get_kinfo_page(stack_frame_t *frame)
+{
+    taskh_t current = sched_get_current();
+    stack_frame_t *next_frame = frame;
+#if CONFIG_MM_KINFO_PAGE
+    const task_meta_t *meta = NULL;
+    uint32_t *svcexch;
+
+    if (unlikely(mgr_task_get_metadata(current, &meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    svcexch = (uint32_t*)task_get_svcexchange(meta);
+    if (svcexch == NULL) {
+        /* this should never happen! */
+        panic(PANIC_CONFIGURATION_MISMATCH);
+    }
+    /* the page is mapped read-only in all tasks at boot time, only its address is delivered */
+    svcexch[0] = (uint32_t)mgr_mm_kinfo_get_page();
+    mgr_task_set_sysreturn(current, STATUS_OK);
+#else
+    /* kernel built without information page */
+    mgr_task_set_sysreturn(current, STATUS_NO_ENTITY);
+#endif
+    return next_frame;
+}
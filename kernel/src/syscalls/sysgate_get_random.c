@@ -34,3 +34,31 @@ stack_frame_t *gate_get_random(stack_frame_t *frame)
 end:
     return next_frame;
 }
+
+stack_frame_t *gate_get_random_buffer(stack_frame_t *frame, uint32_t len)
+{
+    taskh_t current = sched_get_current();
+    stack_frame_t *next_frame = frame;
+    const task_meta_t *meta;
+
+    if (unlikely(mgr_security_has_capa(current, CAP_CRY_KRNG) != SECURE_TRUE)) {
+        mgr_task_set_sysreturn(current, STATUS_DENIED);
+        goto end;
+    }
+    if (unlikely((len == 0) || (len > CONFIG_SVC_EXCHANGE_AREA_LEN))) {
+        mgr_task_set_sysreturn(current, STATUS_INVALID);
+        goto end;
+    }
+    if (unlikely(mgr_task_get_metadata(current, &meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    if (unlikely(mgr_security_entropy_fill((uint8_t*)meta->s_svcexchange, len) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_CRITICAL);
+        goto end;
+    }
+    if (unlikely(mgr_task_set_sysreturn(current, STATUS_OK) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+end:
+    return next_frame;
+}
@@ -4,6 +4,7 @@
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/security.h>
+#include <sentry/managers/debug.h>
 #include <sentry/arch/asm-generic/panic.h>
 #include <sentry/arch/asm-generic/tick.h>
 #include <sentry/sched.h>
@@ -30,7 +31,15 @@ stack_frame_t *gate_log(stack_frame_t *frame, __MAYBE_UNUSED uint32_t log_len)
         panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
     }
     svcexch = (uint8_t*)meta->s_svcexchange;
+#if CONFIG_DEBUG_USER_LOG_DEFERRED
+    /* emitted later, from idle, the task is not delayed by the debug output */
+    if (unlikely(mgr_debug_userlog_push(meta->label, svcexch, log_len) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_BUSY);
+        goto end;
+    }
+#else
     debug_rawlog(svcexch, log_len);
+#endif
     mgr_task_set_sysreturn(current, STATUS_OK);
 end:
     return next_frame;
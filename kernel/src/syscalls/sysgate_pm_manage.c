@@ -4,6 +4,7 @@
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/security.h>
+#include <sentry/managers/debug.h>
 #include <sentry/arch/asm-generic/panic.h>
 #include <sentry/arch/asm-generic/platform.h>
 #include <sentry/sched.h>
@@ -25,6 +26,12 @@ stack_frame_t *gate_pm_manage(stack_frame_t *frame, uint32_t pm_command)
         mgr_task_set_sysreturn(current, STATUS_DENIED);
         goto end;
     }
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+    if (pm_command <= CPU_SLEEP_WAIT_FOR_EVENT) {
+        /* emit the pending logs before sleeping */
+        mgr_debug_idle();
+    }
+#endif
     switch (pm_command) {
         case CPU_SLEEP_WAIT_FOR_EVENT:
             __WFE();
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <sentry/syscalls.h>
+#include <sentry/managers/memory.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/time.h>
 #include <sentry/sched.h>
@@ -67,16 +68,18 @@ deadlock:
     return result;
 }
 
-stack_frame_t *gate_send_ipc(stack_frame_t *frame, taskh_t target, uint32_t len)
+/**
+ * @fn check that an IPC can be emitted from current to target
+ *
+ * @return STATUS_OK if the IPC can be emitted, or the syscall error status
+ */
+static Status ipc_check(taskh_t current, taskh_t target, uint32_t len)
 {
-    stack_frame_t *next_frame = frame;
-    taskh_t current = sched_get_current();
-    taskh_t next;
-    job_state_t dest_state;
+    Status status = STATUS_INVALID;
+
     /* sanitize first */
     if (unlikely(len > (CONFIG_SVC_EXCHANGE_AREA_LEN - sizeof(exchange_event_t)))) {
-        mgr_task_set_sysreturn(current, STATUS_INVALID);
-        goto err;
+        goto end;
     }
     /*
      * if emitting IPC generates a direct (current <-> target) or indirect
@@ -84,20 +87,28 @@ stack_frame_t *gate_send_ipc(stack_frame_t *frame, taskh_t target, uint32_t len)
      * must not initiate an IPC and return STATUS_DEADLK instead.
      */
     if (unlikely(ipc_generates_deadlock(current, target) == SECURE_TRUE)) {
-        mgr_task_set_sysreturn(current, STATUS_DEADLK);
-        goto err;
+        status = STATUS_DEADLK;
+        goto end;
     }
     if (unlikely(mgr_task_handle_exists(target) == SECURE_FALSE)) {
-        mgr_task_set_sysreturn(current, STATUS_INVALID);
-        goto err;
+        goto end;
     }
-    /* TODO: deadlock detecion */
+    status = STATUS_OK;
+end:
+    return status;
+}
+
+/**
+ * @fn block current until its already pushed IPC is read by target
+ *
+ * @return the next job frame
+ */
+static stack_frame_t *ipc_block(stack_frame_t *frame, taskh_t current, taskh_t target)
+{
+    stack_frame_t *next_frame = frame;
+    taskh_t next;
+    job_state_t dest_state;
 
-    /* push IPC event to target */
-    if (unlikely(mgr_task_push_ipc_event(len, current, target) != K_STATUS_OKAY)) {
-        mgr_task_set_sysreturn(current, STATUS_BUSY);
-        goto err;
-    }
     /* except in autotest mode, a job can't send a message to itself */
     if (unlikely(current == target)) {
         mgr_task_set_sysreturn(current, STATUS_INVALID);
@@ -134,6 +145,89 @@ err_autotest:
         mgr_task_set_sysreturn(current, STATUS_OK);
     }
 #endif
+    return next_frame;
+}
+
+stack_frame_t *gate_send_ipc(stack_frame_t *frame, taskh_t target, uint32_t len)
+{
+    stack_frame_t *next_frame = frame;
+    taskh_t current = sched_get_current();
+    Status status;
+
+    status = ipc_check(current, target, len);
+    if (unlikely(status != STATUS_OK)) {
+        mgr_task_set_sysreturn(current, status);
+        goto err;
+    }
+    /* push IPC event to target */
+    if (unlikely(mgr_task_push_ipc_event(len, current, target) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_BUSY);
+        goto err;
+    }
+    next_frame = ipc_block(frame, current, target);
+err:
+    return next_frame;
+}
+
+/**
+ * @fn send an IPC, transferring the given SHM user credentials to the target
+ *
+ * The IPC event is pushed first, then the SHM is revoked from the sender and
+ * mapped in the target, if its credentials allow it. If the transfer fails,
+ * the IPC event is cancelled, so that either both happen or none. The DMA
+ * pool buffers of the previous SHM user are released only once both are done.
+ */
+stack_frame_t *gate_send_ipc_shm(stack_frame_t *frame, taskh_t target, uint32_t len, shmh_t shm)
+{
+    stack_frame_t *next_frame = frame;
+    taskh_t current = sched_get_current();
+    kstatus_t kstatus;
+    taskh_t prev_user;
+    Status status;
+
+#ifndef CONFIG_BUILD_TARGET_AUTOTEST
+    /* the SHM would be transferred before the IPC emission is refused */
+    if (unlikely(current == target)) {
+        mgr_task_set_sysreturn(current, STATUS_INVALID);
+        goto err;
+    }
+#endif
+    status = ipc_check(current, target, len);
+    if (unlikely(status != STATUS_OK)) {
+        mgr_task_set_sysreturn(current, status);
+        goto err;
+    }
+    if (unlikely(mgr_mm_shm_get_user(shm, &prev_user) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_INVALID);
+        goto err;
+    }
+    /* push IPC event to target, cancelled if the SHM can't be transferred */
+    if (unlikely(mgr_task_push_ipc_event(len, current, target) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_BUSY);
+        goto err;
+    }
+    kstatus = mgr_mm_shm_transfer(shm, current, target);
+    if (unlikely(kstatus != K_STATUS_OKAY)) {
+        mgr_task_cancel_ipc_event(current, target);
+        switch (kstatus) {
+            case K_ERROR_DENIED:
+                mgr_task_set_sysreturn(current, STATUS_DENIED);
+                break;
+            case K_ERROR_BUSY:
+                mgr_task_set_sysreturn(current, STATUS_BUSY);
+                break;
+            default:
+                mgr_task_set_sysreturn(current, STATUS_INVALID);
+                break;
+        }
+        goto err;
+    }
+    /*
+     * the previous user, if it has lost the SHM credentials, loses its DMA
+     * pool buffers. K_ERROR_BUSY here means it still accesses the SHM.
+     */
+    mgr_mm_shm_dma_release(shm, prev_user);
+    next_frame = ipc_block(frame, current, target);
 err:
     return next_frame;
 }
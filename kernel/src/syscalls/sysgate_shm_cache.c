@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <uapi/types.h>
+#include <sentry/managers/memory.h>
+#include <sentry/sched.h>
+
+/**
+ * @brief check that the current task can maintain the given SHM range
+ *
+ * The task must be allowed to map the SHM (see mgr_mm_shm_check_access()).
+ * Invalidating discards data written by the core and not yet written back,
+ * and thus requires the write permission on the SHM.
+ *
+ * @param[out] base: start address of the range to maintain
+ * @return STATUS_OK if the range can be maintained, STATUS_NO_ENTITY if the
+ *  SHM is not cacheable (nothing to do)
+ */
+static Status shm_cache_check(taskh_t current, shmh_t shm, size_t offset, size_t len,
+                              secure_bool_t write, size_t *base)
+{
+    Status status = STATUS_INVALID;
+    secure_bool_t result;
+
+    switch (mgr_mm_shm_check_access(shm, current, offset, len, write, base)) {
+        case K_STATUS_OKAY:
+            break;
+        case K_ERROR_DENIED:
+            status = STATUS_DENIED;
+            goto end;
+        default:
+            goto end;
+    }
+    if (unlikely(mgr_mm_shm_is_cacheable(shm, &result) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (result != SECURE_TRUE) {
+        status = STATUS_NO_ENTITY;
+        goto end;
+    }
+    status = STATUS_OK;
+end:
+    return status;
+}
+
+stack_frame_t *gate_shm_cache_clean(stack_frame_t *frame, shmh_t shm, size_t offset, size_t len)
+{
+    taskh_t current = sched_get_current();
+    size_t base = 0;
+    Status status;
+
+    status = shm_cache_check(current, shm, offset, len, SECURE_FALSE, &base);
+    if (status == STATUS_NO_ENTITY) {
+        /* non cacheable SHM, memory is always up to date */
+        status = STATUS_OK;
+        goto end;
+    }
+    if (unlikely(status != STATUS_OK)) {
+        goto end;
+    }
+    if (unlikely(mgr_mm_dcache_clean(base, len) != K_STATUS_OKAY)) {
+        status = STATUS_INVALID;
+    }
+end:
+    mgr_task_set_sysreturn(current, status);
+    return frame;
+}
+
+stack_frame_t *gate_shm_cache_invalidate(stack_frame_t *frame, shmh_t shm, size_t offset, size_t len)
+{
+    taskh_t current = sched_get_current();
+    size_t base = 0;
+    Status status;
+
+    status = shm_cache_check(current, shm, offset, len, SECURE_TRUE, &base);
+    if (status == STATUS_NO_ENTITY) {
+        /* non cacheable SHM, no stale cache line */
+        status = STATUS_OK;
+        goto end;
+    }
+    if (unlikely(status != STATUS_OK)) {
+        goto end;
+    }
+    if (unlikely(mgr_mm_dcache_invalidate(base, len) != K_STATUS_OKAY)) {
+        status = STATUS_INVALID;
+    }
+end:
+    mgr_task_set_sysreturn(current, status);
+    return frame;
+}
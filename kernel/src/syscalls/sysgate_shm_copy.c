@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string.h>
+#include <sentry/syscalls.h>
+#include <sentry/managers/memory.h>
+#include <sentry/managers/task.h>
+#include <sentry/managers/dma.h>
+#include <sentry/arch/asm-generic/panic.h>
+#include <sentry/sched.h>
+#include <uapi/types.h>
+
+#if CONFIG_DMA_KERNEL_MEMCPY
+/**
+ * @brief check that the current task can access the given SHM range
+ *
+ * The DMA is not submitted to the MPU: the task must be allowed to map the
+ * SHM, and to write it for the destination (see mgr_mm_shm_check_access()).
+ *
+ * @param[out] base: start address of the range
+ */
+static Status shm_copy_check(taskh_t current, shmh_t shm, size_t offset, size_t len,
+                             secure_bool_t write, size_t *base)
+{
+    Status status;
+
+    switch (mgr_mm_shm_check_access(shm, current, offset, len, write, base)) {
+        case K_STATUS_OKAY:
+            status = STATUS_OK;
+            break;
+        case K_ERROR_DENIED:
+            status = STATUS_DENIED;
+            break;
+        default:
+            status = STATUS_INVALID;
+            break;
+    }
+    return status;
+}
+#endif
+
+/*
+ * The copy descriptor does not fit in the syscall registers and is read from
+ * the SVC exchange area. The DMA is not submitted to the MPU, all the ranges
+ * are checked here against the SHM declarations and the task permissions.
+ */
+stack_frame_t *gate_shm_copy(stack_frame_t *frame)
+{
+    taskh_t current = sched_get_current();
+    Status status = STATUS_NO_ENTITY;
+#if CONFIG_DMA_KERNEL_MEMCPY
+    const task_meta_t *meta;
+    shm_copy_t desc;
+    size_t src = 0;
+    size_t dst = 0;
+
+    if (unlikely(mgr_task_get_metadata(current, &meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    /* local copy, the task can't update it while being checked */
+    memcpy(&desc, (void*)meta->s_svcexchange, sizeof(shm_copy_t));
+    status = shm_copy_check(current, desc.src, desc.src_offset, desc.len, SECURE_FALSE, &src);
+    if (unlikely(status != STATUS_OK)) {
+        goto end;
+    }
+    status = shm_copy_check(current, desc.dst, desc.dst_offset, desc.len, SECURE_TRUE, &dst);
+    if (unlikely(status != STATUS_OK)) {
+        goto end;
+    }
+    /* ranges are wrap-free, as included in SHMs */
+    if (unlikely((src < (dst + desc.len)) && (dst < (src + desc.len)))) {
+        status = STATUS_INVALID;
+        goto end;
+    }
+    switch (mgr_dma_kernel_memcpy(dst, src, desc.len)) {
+        case K_STATUS_OKAY:
+            status = STATUS_OK;
+            break;
+        case K_ERROR_NOTREADY:
+            status = STATUS_NO_ENTITY;
+            break;
+        case K_ERROR_BUSY:
+            /* stalled transfer, aborted */
+            status = STATUS_TIMEOUT;
+            break;
+        default:
+            /* unaligned range or transfer failure */
+            status = STATUS_INVALID;
+            break;
+    }
+end:
+#endif
+    mgr_task_set_sysreturn(current, status);
+    return frame;
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <sentry/managers/memory.h>
+#include <sentry/managers/task.h>
+#include <sentry/sched.h>
+#include <uapi/types.h>
+
+/**
+ * @brief convert a DMA pool allocator manager error to a syscall status
+ */
+static Status shm_dma_status(kstatus_t kstatus)
+{
+    Status status;
+
+    switch (kstatus) {
+        case K_STATUS_OKAY:
+            status = STATUS_OK;
+            break;
+        case K_ERROR_NOENT:
+            /* not a DMA pool */
+            status = STATUS_NO_ENTITY;
+            break;
+        case K_ERROR_DENIED:
+            status = STATUS_DENIED;
+            break;
+        case K_ERROR_MEMFAIL:
+            /* no free run of blocks large enough, by now */
+            status = STATUS_BUSY;
+            break;
+        default:
+            status = STATUS_INVALID;
+            break;
+    }
+    return status;
+}
+
+stack_frame_t *gate_shm_dma_alloc(stack_frame_t *frame, shmh_t shm, size_t len)
+{
+    taskh_t current = sched_get_current();
+    const task_meta_t *meta;
+    uint32_t *svcexch;
+    size_t offset = 0;
+    Status status;
+
+    status = shm_dma_status(mgr_mm_shm_dma_alloc(shm, current, len, &offset));
+    if (unlikely(status != STATUS_OK)) {
+        goto end;
+    }
+    /* set buffer offset into svcexchange */
+    if (unlikely(mgr_task_get_metadata(current, &meta) != K_STATUS_OKAY)) {
+        panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
+    }
+    svcexch = (uint32_t*)meta->s_svcexchange;
+    svcexch[0] = (uint32_t)offset;
+end:
+    mgr_task_set_sysreturn(current, status);
+    return frame;
+}
+
+stack_frame_t *gate_shm_dma_free(stack_frame_t *frame, shmh_t shm, size_t offset)
+{
+    taskh_t current = sched_get_current();
+
+    mgr_task_set_sysreturn(current, shm_dma_status(mgr_mm_shm_dma_free(shm, current, offset)));
+    return frame;
+}
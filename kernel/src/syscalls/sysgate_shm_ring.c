@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <sentry/managers/memory.h>
+#include <sentry/managers/task.h>
+#include <sentry/managers/time.h>
+#include <sentry/sched.h>
+#include <uapi/types.h>
+
+/**
+ * @brief wake the ring peer up with a SIGNAL_POLL signal
+ *
+ * A SIGNAL_POLL already pending from the caller is enough to wake the peer, the
+ * ring state being read by the peer afterward.
+ */
+static Status shm_ring_wake(taskh_t current, taskh_t peer)
+{
+    Status status = STATUS_INVALID;
+    job_state_t peer_state;
+    kstatus_t kstatus;
+
+    if (unlikely(mgr_task_get_state(peer, &peer_state) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    kstatus = mgr_task_push_sig_event(SIGNAL_POLL, current, peer);
+    if (kstatus == K_ERROR_BUSY) {
+        status = STATUS_OK;
+        goto end;
+    }
+    if (unlikely(kstatus != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if ((peer != current) &&
+        ((peer_state == JOB_STATE_SLEEPING) ||
+         (peer_state == JOB_STATE_WAITFOREVENT))) {
+        /* as for sys_send_signal(), remove the peer from the delay queue if needed */
+        mgr_time_delay_del_job(peer);
+        mgr_task_set_sysreturn(peer, STATUS_INTR);
+        mgr_task_set_state(peer, JOB_STATE_READY);
+        sched_schedule(peer);
+    }
+    status = STATUS_OK;
+end:
+    return status;
+}
+
+stack_frame_t *gate_shm_ring_doorbell(stack_frame_t *frame, shmh_t shm, uint32_t event)
+{
+    taskh_t current = sched_get_current();
+    Status status = STATUS_INVALID;
+    shm_user_t accessor;
+    secure_bool_t wake = SECURE_FALSE;
+    taskh_t peer;
+    kstatus_t kstatus;
+
+    if (unlikely(mgr_mm_shm_get_task_type(shm, current, &accessor) != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (unlikely(accessor == SHM_TSK_NONE)) {
+        status = STATUS_DENIED;
+        goto end;
+    }
+    kstatus = mgr_mm_shm_ring_doorbell(shm, accessor, event, &peer, &wake);
+    if (unlikely(kstatus == K_ERROR_DENIED)) {
+        status = STATUS_DENIED;
+        goto end;
+    }
+    if (unlikely(kstatus != K_STATUS_OKAY)) {
+        goto end;
+    }
+    if (wake == SECURE_TRUE) {
+        status = shm_ring_wake(current, peer);
+        goto end;
+    }
+    status = STATUS_OK;
+end:
+    mgr_task_set_sysreturn(current, status);
+    return frame;
+}
@@ -6,11 +6,50 @@
 #include <sentry/managers/memory.h>
 #include <sentry/sched.h>
 
+/**
+ * @brief declare, update or remove a read-only reader of the SHM
+ *
+ * READER can only be combined with MAP and READ, as readers never write nor
+ * transfer the SHM. READER without MAP removes the reader.
+ */
+static Status shm_setcreds_reader(shmh_t shm, taskh_t target, SHMPermission perms)
+{
+    Status status = STATUS_INVALID;
+    shm_config_t config;
+    kstatus_t kstatus;
+
+    if (unlikely(perms & (SHM_PERMISSION_WRITE | SHM_PERMISSION_TRANSFER))) {
+        goto end;
+    }
+    if (perms & SHM_PERMISSION_MAP) {
+        config.mappable = SECURE_TRUE;
+        config.rw = SECURE_FALSE;
+        config.transferable = SECURE_FALSE;
+        kstatus = mgr_mm_shm_declare_reader(shm, target, &config);
+    } else {
+        kstatus = mgr_mm_shm_remove_reader(shm, target);
+    }
+    switch (kstatus) {
+        case K_STATUS_OKAY:
+            status = STATUS_OK;
+            break;
+        case K_ERROR_BUSY:
+            /* no more reader slot, or reader has the SHM mapped */
+            status = STATUS_BUSY;
+            break;
+        default:
+            break;
+    }
+end:
+    return status;
+}
+
 stack_frame_t *gate_shm_setcreds(stack_frame_t *frame, shmh_t shm, taskh_t target, SHMPermission perms)
 {
     taskh_t current = sched_get_current();
     shmh_t shmhandle;
     shm_user_t user;
+    shm_user_t target_type;
     shm_config_t config;
     secure_bool_t is_mapped = SECURE_TRUE;
 
@@ -29,11 +68,28 @@ stack_frame_t *gate_shm_setcreds(stack_frame_t *frame, shmh_t shm, taskh_t targe
         mgr_task_set_sysreturn(current, STATUS_INVALID);
         goto end;
     }
-    if (unlikely(user == SHM_TSK_USER)) {
+    if (unlikely(user != SHM_TSK_OWNER)) {
         /* only owner can set SHM creds */
         mgr_task_set_sysreturn(current, STATUS_DENIED);
         goto end;
     }
+    if (perms & SHM_PERMISSION_READER) {
+        if (unlikely(target == current)) {
+            mgr_task_set_sysreturn(current, STATUS_INVALID);
+            goto end;
+        }
+        mgr_task_set_sysreturn(current, shm_setcreds_reader(shm, target, perms));
+        goto end;
+    }
+    if (unlikely(mgr_mm_shm_get_task_type(shm, target, &target_type) != K_STATUS_OKAY)) {
+        mgr_task_set_sysreturn(current, STATUS_INVALID);
+        goto end;
+    }
+    if (unlikely(SHM_TSK_IS_READER(target_type))) {
+        /* a reader must be removed before being declared as SHM user */
+        mgr_task_set_sysreturn(current, STATUS_INVALID);
+        goto end;
+    }
     mgr_mm_shm_is_mapped_by(shm, user, &is_mapped);
     if (unlikely(is_mapped == SECURE_TRUE)) {
         /* can't set creds for a user (or owner) that already have the SHM mapped */
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sentry/syscalls.h>
+#include <uapi/types.h>
+#include <sentry/managers/task.h>
+#include <sentry/managers/security.h>
+#include <sentry/managers/debug.h>
+#include <sentry/sched.h>
+
+stack_frame_t *gate_trigger_irq_probe(stack_frame_t *frame, uint32_t ticks __attribute__((unused)))
+{
+    taskh_t current = sched_get_current();
+
+    if (unlikely(mgr_security_has_capa(current, CAP_SYS_DEBUG) != SECURE_TRUE)) {
+        mgr_task_set_sysreturn(current, STATUS_DENIED);
+        goto end;
+    }
+#if CONFIG_DEBUG_IRQ_PROBE
+    switch (mgr_debug_irqprobe_arm(current, ticks)) {
+        case K_STATUS_OKAY:
+            mgr_task_set_sysreturn(current, STATUS_OK);
+            break;
+        case K_ERROR_BUSY:
+            mgr_task_set_sysreturn(current, STATUS_BUSY);
+            break;
+        default:
+            mgr_task_set_sysreturn(current, STATUS_NO_ENTITY);
+            break;
+    }
+#else
+    /* latency probe not supported by this build */
+    mgr_task_set_sysreturn(current, STATUS_NO_ENTITY);
+#endif
+end:
+    return frame;
+}
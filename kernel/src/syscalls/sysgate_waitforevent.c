@@ -4,6 +4,7 @@
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
 #include <sentry/managers/time.h>
+#include <sentry/managers/debug.h>
 #include <sentry/sched.h>
 #include <uapi/types.h>
 #include <uapi/dma.h>
@@ -115,9 +116,14 @@ stack_frame_t *gate_waitforevent(stack_frame_t *frame,
         uint32_t irqn;
         devh_t devh;
         if (mgr_task_load_int_event(current, &irqn) == K_STATUS_OKAY) {
+            devh = 0;
+            /* kernel owned interrupts (latency probe) have no device source */
             mgr_device_get_devh_from_interrupt(irqn, &devh);
             gate_waitforevent_populate_interrupt(current, irqn, devh);
             mgr_task_set_sysreturn(current, STATUS_OK);
+#if CONFIG_DEBUG_IRQ_PROBE
+            mgr_debug_irqprobe_delivered(irqn);
+#endif
             goto end;
         }
     }
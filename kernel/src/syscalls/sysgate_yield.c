@@ -3,6 +3,7 @@
 
 #include <sentry/syscalls.h>
 #include <sentry/managers/task.h>
+#include <sentry/managers/debug.h>
 #include <sentry/arch/asm-generic/panic.h>
 #include <sentry/sched.h>
 
@@ -12,6 +13,12 @@ stack_frame_t *gate_yield(stack_frame_t *frame)
     taskh_t next;
     stack_frame_t *next_frame = frame;
 
+#if CONFIG_DEBUG_OUTPUT_DEFERRED
+    /* idle yields when there is nothing else to do, emit the pending logs */
+    if (mgr_task_is_idletask(current) == SECURE_TRUE) {
+        mgr_debug_idle();
+    }
+#endif
     next = sched_elect();
     if (unlikely(mgr_task_get_sp(next, &next_frame) != K_STATUS_OKAY)) {
         panic(PANIC_KERNEL_INVALID_MANAGER_RESPONSE);
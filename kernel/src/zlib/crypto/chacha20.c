@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inttypes.h>
+#include <sentry/zlib/crypto.h>
+
+/*
+ * ChaCha20 block function, as defined in RFC 8439, section 2.3.
+ * Only the block function is implemented, as the kernel uses it as DRBG
+ * core, not as a stream cipher.
+ */
+
+/* "expand 32-byte k", little endian words */
+#define CHACHA20_CONST0 0x61707865UL
+#define CHACHA20_CONST1 0x3320646eUL
+#define CHACHA20_CONST2 0x79622d32UL
+#define CHACHA20_CONST3 0x6b206574UL
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) do { \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8);  \
+    c += d; b ^= c; b = ROTL32(b, 7);  \
+} while (0)
+
+/*@
+    requires \valid(out + (0 .. 15));
+    requires \valid_read(key + (0 .. 7));
+    requires \valid_read(nonce + (0 .. 2));
+    assigns out[0 .. 15];
+  */
+void chacha20_block(uint32_t out[16], uint32_t const key[8], uint32_t counter, uint32_t const nonce[3])
+{
+    /* the working state is kept in locals so that it stays in registers */
+    uint32_t x0 = CHACHA20_CONST0, x1 = CHACHA20_CONST1;
+    uint32_t x2 = CHACHA20_CONST2, x3 = CHACHA20_CONST3;
+    uint32_t x4 = key[0], x5 = key[1], x6 = key[2], x7 = key[3];
+    uint32_t x8 = key[4], x9 = key[5], x10 = key[6], x11 = key[7];
+    uint32_t x12 = counter, x13 = nonce[0], x14 = nonce[1], x15 = nonce[2];
+    uint8_t i;
+
+    /*@
+      loop invariant 0 <= i <= 10;
+      loop assigns i, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15;
+      loop variant 10 - i;
+      */
+    for (i = 0; i < 10; ++i) {
+        /* column rounds */
+        QUARTERROUND(x0, x4, x8, x12);
+        QUARTERROUND(x1, x5, x9, x13);
+        QUARTERROUND(x2, x6, x10, x14);
+        QUARTERROUND(x3, x7, x11, x15);
+        /* diagonal rounds */
+        QUARTERROUND(x0, x5, x10, x15);
+        QUARTERROUND(x1, x6, x11, x12);
+        QUARTERROUND(x2, x7, x8, x13);
+        QUARTERROUND(x3, x4, x9, x14);
+    }
+    out[0] = x0 + CHACHA20_CONST0;
+    out[1] = x1 + CHACHA20_CONST1;
+    out[2] = x2 + CHACHA20_CONST2;
+    out[3] = x3 + CHACHA20_CONST3;
+    out[4] = x4 + key[0];
+    out[5] = x5 + key[1];
+    out[6] = x6 + key[2];
+    out[7] = x7 + key[3];
+    out[8] = x8 + key[4];
+    out[9] = x9 + key[5];
+    out[10] = x10 + key[6];
+    out[11] = x11 + key[7];
+    out[12] = x12 + counter;
+    out[13] = x13 + nonce[0];
+    out[14] = x14 + nonce[1];
+    out[15] = x15 + nonce[2];
+}
@@ -1,11 +1,12 @@
 // SPDX-FileCopyrightText: 2023 Ledger SAS
 // SPDX-License-Identifier: Apache-2.0
 
+#include <assert.h>
 #include <string.h>
 #include <sentry/ktypes.h>
 
 /* string related functions, for debug usage only */
-#ifndef __FRAMAC__
+#if !defined(__FRAMAC__) && !defined(TEST_MODE)
 static
 #endif
 size_t sentry_strnlen(const char *s, size_t maxlen)
@@ -24,6 +25,111 @@ err:
     return result;
 }
 
+/*
+ * Word-wise helpers. The kernel enables the unaligned access trap
+ * (SCB->CCR.UNALIGN_TRP), so that all word accesses below are made on word
+ * aligned addresses. Head and tail bytes are handled byte per byte.
+ *
+ * Blocks of 8 words are loaded in locals before being stored, so that the
+ * compiler emits LDM/STM bursts on Arm targets.
+ */
+#define WORD_LEN       sizeof(uint32_t)
+#define WORD_MASK      (WORD_LEN - 1UL)
+/* below this length, unaligned areas are handled byte per byte */
+#define SMALL_LEN      (4UL * WORD_LEN)
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "misaligned copy requires little endian");
+
+static inline void set_words(uint32_t *d, uint32_t pattern, size_t words)
+{
+    while (words >= 8) {
+        d[0] = pattern;
+        d[1] = pattern;
+        d[2] = pattern;
+        d[3] = pattern;
+        d[4] = pattern;
+        d[5] = pattern;
+        d[6] = pattern;
+        d[7] = pattern;
+        d += 8;
+        words -= 8;
+    }
+    while (words) {
+        *d = pattern;
+        d++;
+        words--;
+    }
+}
+
+static inline void copy_aligned_words(uint32_t *d, const uint32_t *s, size_t words)
+{
+    while (words >= 8) {
+        uint32_t w0 = s[0];
+        uint32_t w1 = s[1];
+        uint32_t w2 = s[2];
+        uint32_t w3 = s[3];
+        uint32_t w4 = s[4];
+        uint32_t w5 = s[5];
+        uint32_t w6 = s[6];
+        uint32_t w7 = s[7];
+        d[0] = w0;
+        d[1] = w1;
+        d[2] = w2;
+        d[3] = w3;
+        d[4] = w4;
+        d[5] = w5;
+        d[6] = w6;
+        d[7] = w7;
+        d += 8;
+        s += 8;
+        words -= 8;
+    }
+    while (words) {
+        *d = *s;
+        d++;
+        s++;
+        words--;
+    }
+}
+
+/*
+ * d is word aligned, src is not. Source words are read aligned and merged
+ * by shifting. The last aligned word read always holds at least one source
+ * byte, so that no read crosses the source range word boundary.
+ */
+static inline void copy_shifted_words(uint32_t *d, const uint8_t *src, size_t words)
+{
+    size_t offset = (size_t)src & WORD_MASK;
+    const uint32_t *s = (const uint32_t*)((size_t)src - offset);
+    uint32_t rshift = 8UL * offset;
+    uint32_t lshift = 32UL - rshift;
+    uint32_t prev = *s;
+
+    s++;
+    while (words >= 4) {
+        uint32_t w0 = s[0];
+        uint32_t w1 = s[1];
+        uint32_t w2 = s[2];
+        uint32_t w3 = s[3];
+        d[0] = (prev >> rshift) | (w0 << lshift);
+        d[1] = (w0 >> rshift) | (w1 << lshift);
+        d[2] = (w1 >> rshift) | (w2 << lshift);
+        d[3] = (w2 >> rshift) | (w3 << lshift);
+        prev = w3;
+        d += 4;
+        s += 4;
+        words -= 4;
+    }
+    while (words) {
+        uint32_t w = *s;
+        *d = (prev >> rshift) | (w << lshift);
+        prev = w;
+        d++;
+        s++;
+        words--;
+    }
+}
+
 /**
  * @brief Set n first bytes of a given memory area with a given byte value
  *
@@ -36,7 +142,7 @@ err:
  * Conforming to:
  * POSIX.1-2001, POSIX.1-2008, C89, C99, SVr4, 4.3BSD.
  */
-#ifndef __FRAMAC__
+#if !defined(__FRAMAC__) && !defined(TEST_MODE)
 static
 #endif
 void   *sentry_memset(void *s, int c, unsigned int n)
@@ -49,11 +155,28 @@ void   *sentry_memset(void *s, int c, unsigned int n)
         goto err;
     }
 
-    /* memseting s with c */
-    char   *bytes = s;
+    uint8_t *bytes = s;
+    uint8_t byte = (uint8_t)c;
+    uint32_t pattern = byte * 0x01010101UL;
+    size_t words;
 
+    if (n >= SMALL_LEN) {
+        /* head, up to the first word boundary */
+        while (((size_t)bytes & WORD_MASK) != 0) {
+            *bytes = byte;
+            bytes++;
+            n--;
+        }
+    }
+    if (((size_t)bytes & WORD_MASK) == 0) {
+        words = n / WORD_LEN;
+        set_words((uint32_t*)bytes, pattern, words);
+        bytes += words * WORD_LEN;
+        n -= words * WORD_LEN;
+    }
+    /* tail */
     while (n) {
-        *bytes = c;
+        *bytes = byte;
         bytes++;
         n--;
     }
@@ -77,7 +200,7 @@ err:
     return res;
 }
 
-#ifndef __FRAMAC__
+#if !defined(__FRAMAC__) && !defined(TEST_MODE)
 static
 #endif
 void   *sentry_memcpy(void * restrict dest, const void* restrict src, size_t n)
@@ -89,19 +212,32 @@ void   *sentry_memcpy(void * restrict dest, const void* restrict src, size_t n)
         goto err;
     }
 
-    uint32_t *s = (uint32_t*)src;
-    uint32_t *d = (uint32_t*)dest;
+    const uint8_t *s8 = src;
+    uint8_t *d8 = dest;
+    size_t words;
 
-    /* copy word by word */
-    while (n >= 4) {
-        *d = *s;
-        d++;
-        s++;
-        n -= 4;
+    if (n >= SMALL_LEN) {
+        /* head, up to the first destination word boundary */
+        while (((size_t)d8 & WORD_MASK) != 0) {
+            *d8 = *s8;
+            d8++;
+            s8++;
+            n--;
+        }
+    }
+    words = n / WORD_LEN;
+    if ((((size_t)d8 | (size_t)s8) & WORD_MASK) == 0) {
+        copy_aligned_words((uint32_t*)d8, (const uint32_t*)s8, words);
+    } else if (((size_t)d8 & WORD_MASK) == 0) {
+        copy_shifted_words((uint32_t*)d8, s8, words);
+    } else {
+        /* short unaligned copy */
+        words = 0;
     }
-    /* if n is not word aligned, finishing with last bytes */
-    uint8_t *s8 = (uint8_t*)s;
-    uint8_t *d8 = (uint8_t*)d;
+    d8 += words * WORD_LEN;
+    s8 += words * WORD_LEN;
+    n -= words * WORD_LEN;
+    /* tail */
     while (n) {
         *d8 = *s8;
         d8++;
@@ -12,6 +12,14 @@
 #include <bsp/drivers/exti/exti.h>
 #include <sentry/ktypes.h>
 #include "stm32-exti-dt.h"
+#include "exti_defs.h"
+
+/* multi-banks EXTI controllers name their first bank registers with a '1' suffix */
+#if defined(EXTI_SWIER1_REG)
+#define TEST_EXTI_SWIER_REG EXTI_SWIER1_REG
+#else
+#define TEST_EXTI_SWIER_REG EXTI_SWIER_REG
+#endif
 
 
 class ExtiDevice : public testing::Test {
@@ -110,3 +118,29 @@ TEST_F(ExtiDevice, TestUnmaskInterrupt)
         }
     };
 }
+
+TEST_F(ExtiDevice, TestGenerateSwInterrupt)
+{
+    volatile uint32_t *swier = (volatile uint32_t*)(EXTI_BASE_ADDR + TEST_EXTI_SWIER_REG);
+
+    /* interrupt masked at reset */
+    EXPECT_EQ(exti_generate_swinterrupt(0), K_ERROR_BADSTATE);
+    EXPECT_EQ(*swier, 0UL);
+    ASSERT_EQ(exti_unmask_interrupt(0), K_STATUS_OKAY);
+    EXPECT_EQ(exti_generate_swinterrupt(0), K_STATUS_OKAY);
+    /* the software trigger is set in SWIER, no other register bit */
+    EXPECT_EQ(*swier, 0x1UL);
+    /* already pending */
+    EXPECT_EQ(exti_generate_swinterrupt(0), K_ERROR_BADSTATE);
+    EXPECT_EQ(exti_generate_swinterrupt(EXTI_NUM_INTERRUPTS + 1), K_ERROR_INVPARAM);
+}
+
+TEST_F(ExtiDevice, TestGetIrqn)
+{
+    uint32_t irqn = 0xffffffffUL;
+
+    EXPECT_EQ(exti_get_irqn(EXTI_NUM_INTERRUPTS, &irqn), K_ERROR_INVPARAM);
+    EXPECT_EQ(irqn, 0xffffffffUL);
+    EXPECT_EQ(exti_get_irqn(0, &irqn), K_STATUS_OKAY);
+    EXPECT_EQ(irqn, stm32_exti_get_desc()->irqs[0]);
+}
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <sentry/ktypes.h>
+#include <gtest/gtest.h>
+#include <sentry/managers/debug.h>
+
+/*
+ * binlog.c state (record ring) is global, tests can't be executed in parallel.
+ * Each test starts with an empty ring.
+ *
+ * Format strings are stored in a single blob, standing for the .logfmt
+ * section. Flash strings are stored in another one, standing for .text.
+ */
+static const char logfmt[] =
+    "value %u\0"
+    "string %s\0"
+    "star %*d|%-*d|%.*s|\0"
+    "wide %llx %d\0"
+    "all %d %i %u %x %X %08x %-5d| %+d %c %s %s %p %lld %llu %llx %*d %-*d| %.*s %5.2s %% %hx %lu %zu\n\0";
+static const char flash[] = "flash string";
+
+static std::string test_output;
+static secure_bool_t test_spawned = SECURE_FALSE;
+
+extern "C" {
+    const char *_stext = flash;
+    const char *_etext = flash + sizeof(flash);
+    const char *_slogfmt = logfmt;
+    const char *_elogfmt = logfmt + sizeof(logfmt);
+
+    secure_bool_t mgr_task_is_userspace_spawned(void) {
+        return test_spawned;
+    }
+
+    kstatus_t debug_rawlog(const uint8_t *logbuf, size_t len) {
+        test_output.append(reinterpret_cast<const char *>(logbuf), len);
+        return K_STATUS_OKAY;
+    }
+}
+
+/* n-th format string of the blob */
+static const char *fmt(unsigned int n)
+{
+    const char *str = logfmt;
+
+    while (n-- > 0) {
+        str += strlen(str) + 1;
+    }
+    return str;
+}
+
+static uint16_t fmt_id(unsigned int n)
+{
+    return static_cast<uint16_t>(fmt(n) - logfmt);
+}
+
+static std::string u32(uint32_t val)
+{
+    return std::string(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+static std::string header(uint16_t id, uint8_t len)
+{
+    std::string hdr = { '\xff', static_cast<char>(len) };
+
+    hdr.append(reinterpret_cast<const char *>(&id), sizeof(id));
+    return hdr;
+}
+
+class BinlogTest : public testing::Test {
+    void SetUp() override {
+        test_spawned = SECURE_FALSE;
+        mgr_debug_binlog_drain(SIZE_MAX);
+        test_output.clear();
+    }
+};
+
+TEST_F(BinlogTest, TestInvalidFormat) {
+    static const char notlogfmt[] = "value %u";
+
+    EXPECT_EQ(binlog_emit(notlogfmt, 1U), K_ERROR_INVPARAM);
+    EXPECT_EQ(mgr_debug_binlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_TRUE(test_output.empty());
+}
+
+TEST_F(BinlogTest, TestDeferredRecord) {
+    ASSERT_EQ(binlog_emit(fmt(0), 42U), K_STATUS_OKAY);
+    /* nothing emitted until the ring is drained */
+    EXPECT_TRUE(test_output.empty());
+    EXPECT_EQ(mgr_debug_binlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_EQ(test_output, header(fmt_id(0), 4) + u32(42));
+}
+
+TEST_F(BinlogTest, TestStrings) {
+    const char ram[] = "ram";
+    std::string longstr(40, 'l');
+
+    ASSERT_EQ(binlog_emit(fmt(1), ram), K_STATUS_OKAY);
+    ASSERT_EQ(binlog_emit(fmt(1), flash), K_STATUS_OKAY);
+    /* RAM strings are truncated */
+    ASSERT_EQ(binlog_emit(fmt(1), longstr.c_str()), K_STATUS_OKAY);
+    mgr_debug_binlog_drain(SIZE_MAX);
+    EXPECT_EQ(test_output,
+              header(fmt_id(1), 8) + u32(0) + std::string("\x03ram") +
+              header(fmt_id(1), 4) + u32(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(flash))) +
+              header(fmt_id(1), 37) + u32(0) + std::string("\x20") + longstr.substr(0, 32));
+}
+
+TEST_F(BinlogTest, TestStarArguments) {
+    ASSERT_EQ(binlog_emit(fmt(2), 5, 12, -3, 7, 2, "abc"), K_STATUS_OKAY);
+    mgr_debug_binlog_drain(SIZE_MAX);
+    /* '*' width and precision are emitted before the argument they apply to */
+    EXPECT_EQ(test_output,
+              header(fmt_id(2), 28) + u32(5) + u32(12) + u32(static_cast<uint32_t>(-3)) + u32(7) +
+              u32(2) + u32(0) + std::string("\x03" "abc"));
+}
+
+TEST_F(BinlogTest, TestWholeRecordDrain) {
+    std::string first = header(fmt_id(0), 4) + u32(1);
+    std::string second = header(fmt_id(3), 12) + u32(2) + u32(0) + u32(3);
+
+    ASSERT_EQ(binlog_emit(fmt(0), 1U), K_STATUS_OKAY);
+    ASSERT_EQ(binlog_emit(fmt(3), 2ULL, 3), K_STATUS_OKAY);
+    /* at least one record is emitted, never a partial one */
+    EXPECT_EQ(mgr_debug_binlog_drain(1), SECURE_FALSE);
+    EXPECT_EQ(test_output, first);
+    EXPECT_EQ(mgr_debug_binlog_drain(first.size() + second.size() - 1), SECURE_TRUE);
+    EXPECT_EQ(test_output, first + second);
+}
+
+TEST_F(BinlogTest, TestRingWrap) {
+    std::string record = header(fmt_id(0), 4) + u32(0xa5a5a5a5UL);
+
+    /* 8 bytes records in a 1024 bytes ring, with drains not aligned on the ring size */
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(binlog_emit(fmt(1), "x"), K_STATUS_OKAY);
+        mgr_debug_binlog_drain(SIZE_MAX);
+    }
+    for (uint32_t i = 0; i < 300; ++i) {
+        test_output.clear();
+        ASSERT_EQ(binlog_emit(fmt(0), 0xa5a5a5a5UL), K_STATUS_OKAY);
+        EXPECT_EQ(mgr_debug_binlog_drain(SIZE_MAX), SECURE_TRUE);
+        EXPECT_EQ(test_output, record);
+    }
+}
+
+TEST_F(BinlogTest, TestBootSynchronousDrain) {
+    std::string expected;
+
+    /* no record is lost before userspace is spawned */
+    for (uint32_t i = 0; i < 300; ++i) {
+        ASSERT_EQ(binlog_emit(fmt(0), i), K_STATUS_OKAY);
+        expected += header(fmt_id(0), 4) + u32(i);
+    }
+    EXPECT_FALSE(test_output.empty());
+    mgr_debug_binlog_drain(SIZE_MAX);
+    EXPECT_EQ(test_output, expected);
+}
+
+TEST_F(BinlogTest, TestDroppedRecords) {
+    std::string expected;
+    uint32_t i = 0;
+
+    test_spawned = SECURE_TRUE;
+    while (binlog_emit(fmt(0), i) == K_STATUS_OKAY) {
+        expected += header(fmt_id(0), 4) + u32(i);
+        i++;
+    }
+    EXPECT_EQ(binlog_emit(fmt(0), i), K_ERROR_BUSY);
+    EXPECT_TRUE(test_output.empty());
+    mgr_debug_binlog_drain(SIZE_MAX);
+    ASSERT_EQ(binlog_emit(fmt(0), 1000U), K_STATUS_OKAY);
+    mgr_debug_binlog_drain(SIZE_MAX);
+    /* drop record, reserved 0xffff identifier, is queued before the next accepted one */
+    expected += header(0xffff, 4) + u32(2) + header(fmt_id(0), 4) + u32(1000);
+    EXPECT_EQ(test_output, expected);
+}
+
+TEST_F(BinlogTest, TestTickDrain) {
+    std::string record = header(fmt_id(0), 4) + u32(0);
+    std::string expected;
+
+    /* 16 records of 8 bytes, a drain chunk holds 8 of them */
+    for (uint32_t i = 0; i < 16; ++i) {
+        ASSERT_EQ(binlog_emit(fmt(0), 0U), K_STATUS_OKAY);
+    }
+    for (uint32_t tick = 1; tick < CONFIG_DEBUG_BINARY_LOG_TICK_PERIOD; ++tick) {
+        mgr_debug_binlog_tick();
+    }
+    EXPECT_TRUE(test_output.empty());
+    mgr_debug_binlog_tick();
+    for (uint32_t i = 0; i < (CONFIG_DEBUG_BINARY_LOG_DRAIN_CHUNK / record.size()); ++i) {
+        expected += record;
+    }
+    EXPECT_EQ(test_output, expected);
+}
+
+/*
+ * Encoder part of the tools/binlog_decode.py round trip test
+ * (test_binlog_decode.py), only executed from it. The capture, the .logfmt
+ * blob and the host libc formatted logs are written to BINLOG_ROUNDTRIP_DIR.
+ */
+TEST_F(BinlogTest, TestRoundTrip) {
+    const char *dir = getenv("BINLOG_ROUNDTRIP_DIR");
+    const char ram[] = "ram";
+    char expected[512];
+    int len;
+
+    if (dir == nullptr) {
+        GTEST_SKIP() << "executed by test_binlog_decode.py";
+    }
+#define ROUNDTRIP_ARGS \
+    -42, 42, 42U, 0xcafeU, 0xcafeU, 0xbeefU, -7, 3, 'z', ram, flash, reinterpret_cast<void *>(0x12345678UL), \
+    -1234567890123LL, 1234567890123ULL, 0xdeadbeefcafeULL, 6, -4, 4, 9, 3, "abcdef", "xyz", \
+    static_cast<unsigned short>(0xbeef), 123456UL, static_cast<size_t>(99)
+    ASSERT_EQ(binlog_emit(fmt(4), ROUNDTRIP_ARGS), K_STATUS_OKAY);
+    len = snprintf(expected, sizeof(expected), fmt(4), ROUNDTRIP_ARGS);
+#undef ROUNDTRIP_ARGS
+    ASSERT_GT(len, 0);
+    ASSERT_EQ(binlog_emit(fmt(2), -5, 12, 3, 7, -1, "abc"), K_STATUS_OKAY);
+    len += snprintf(&expected[len], sizeof(expected) - len, fmt(2), -5, 12, 3, 7, -1, "abc");
+    mgr_debug_binlog_drain(SIZE_MAX);
+
+    std::string path(dir);
+    std::ofstream(path + "/capture.bin", std::ios::binary) << test_output;
+    std::ofstream(path + "/logfmt.bin", std::ios::binary) << std::string(logfmt, sizeof(logfmt));
+    std::ofstream(path + "/flash.bin", std::ios::binary) << std::string(flash, sizeof(flash));
+    std::ofstream(path + "/expected.txt", std::ios::binary) << std::string(expected, len);
+    /* truncated as on target, 32 bits addresses */
+    std::ofstream(path + "/layout.txt")
+        << static_cast<uint32_t>(reinterpret_cast<uintptr_t>(logfmt)) << " "
+        << static_cast<uint32_t>(reinterpret_cast<uintptr_t>(flash)) << "\n";
+}
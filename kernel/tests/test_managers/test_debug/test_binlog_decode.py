@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2024 Ledger SAS
+# SPDX-License-Identifier: Apache-2.0
+
+"""Binary log round trip test.
+
+Records are encoded by the kernel binlog.c implementation, through the
+test_binlog executable (BinlogTest.TestRoundTrip), and decoded by
+tools/binlog_decode.py. The decoded text must match the same logs formatted by
+the host libc.
+
+Usage:
+
+    test_binlog_decode.py test_binlog tools_dir
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+
+
+class BlobImage:
+    """ElfImage-like string resolver, over the test .logfmt and flash blobs."""
+
+    def __init__(self, logfmt, logfmt_base, flash, flash_base):
+        self.areas = [(logfmt_base, logfmt), (flash_base, flash)]
+
+    def read_cstring(self, addr):
+        for base, content in self.areas:
+            if base <= addr < base + len(content):
+                offset = addr - base
+                return content[offset:content.index(b"\0", offset)].decode()
+        return None
+
+    def format_string(self, fmt_id):
+        base, _ = self.areas[0]
+        return self.read_cstring(base + fmt_id)
+
+
+class TestBinlogDecode(unittest.TestCase):
+    encoder = None
+
+    def setUp(self):
+        self.dir = tempfile.TemporaryDirectory()
+        env = dict(os.environ, BINLOG_ROUNDTRIP_DIR=self.dir.name)
+        subprocess.run([self.encoder, "--gtest_filter=BinlogTest.TestRoundTrip"], env=env, check=True,
+                       stdout=subprocess.DEVNULL)
+
+    def tearDown(self):
+        self.dir.cleanup()
+
+    def read(self, name):
+        with open(os.path.join(self.dir.name, name), "rb") as blob:
+            return blob.read()
+
+    def decoder(self):
+        logfmt_base, flash_base = (int(addr) for addr in self.read("layout.txt").split())
+        image = BlobImage(self.read("logfmt.bin"), logfmt_base, self.read("flash.bin"), flash_base)
+        return BinlogDecoder(image)
+
+    def test_roundtrip(self):
+        text, pending = self.decoder().decode_stream(self.read("capture.bin"))
+        self.assertEqual(pending, b"")
+        self.assertEqual(text, self.read("expected.txt").decode())
+
+    def test_split_capture(self):
+        decoder = self.decoder()
+        capture = self.read("capture.bin")
+        out = []
+        pending = b""
+        # records split between capture chunks are kept for the next one
+        for pos in range(0, len(capture), 7):
+            text, pending = decoder.decode_stream(pending + capture[pos:pos + 7])
+            out.append(text)
+        self.assertEqual(pending, b"")
+        self.assertEqual("".join(out), self.read("expected.txt").decode())
+
+    def test_text_and_drop_records(self):
+        record = bytes([0xFF, 4, 0xFF, 0xFF]) + (3).to_bytes(4, "little")
+        text, pending = self.decoder().decode_stream(b"user log\n" + record + b"other log\n")
+        self.assertEqual(pending, b"")
+        self.assertEqual(text, "user log\n<binlog: 3 record(s) dropped>\nother log\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__, file=sys.stderr)
+        sys.exit(1)
+    TestBinlogDecode.encoder = sys.argv[1]
+    sys.path.insert(0, sys.argv[2])
+    from binlog_decode import BinlogDecoder
+    unittest.main(argv=sys.argv[:1])
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <string>
+#include <sentry/ktypes.h>
+#include <gtest/gtest.h>
+#include <sentry/managers/debug.h>
+
+/*
+ * userlog.c state (ring, per task credits) is global, tests can't be executed
+ * in parallel. Each test uses its own task labels, and starts with an empty
+ * ring.
+ */
+static uint64_t test_now;
+static std::string test_output;
+
+extern "C" {
+    uint64_t userlog_now(void) {
+        return test_now;
+    }
+
+    kstatus_t debug_rawlog(const uint8_t *logbuf, size_t len) {
+        test_output.append(reinterpret_cast<const char *>(logbuf), len);
+        return K_STATUS_OKAY;
+    }
+}
+
+class UserlogTest : public testing::Test {
+    void SetUp() override {
+        mgr_debug_userlog_drain(SIZE_MAX);
+        test_output.clear();
+        /* always leave enough time to reach full burst credit of known labels */
+        test_now += 1000000ULL;
+    }
+
+protected:
+    kstatus_t push(uint32_t label, const std::string &log) {
+        return mgr_debug_userlog_push(label, reinterpret_cast<const uint8_t *>(log.data()), log.size());
+    }
+};
+
+TEST_F(UserlogTest, TestDrainOrder) {
+    ASSERT_EQ(push(1, "hello "), K_STATUS_OKAY);
+    ASSERT_EQ(push(1, "world"), K_STATUS_OKAY);
+    EXPECT_EQ(mgr_debug_userlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_EQ(test_output, "hello world");
+}
+
+TEST_F(UserlogTest, TestBoundedDrain) {
+    std::string log(100, 'a');
+
+    ASSERT_EQ(push(2, log), K_STATUS_OKAY);
+    EXPECT_EQ(mgr_debug_userlog_drain(30), SECURE_FALSE);
+    EXPECT_EQ(test_output.size(), 30U);
+    EXPECT_EQ(mgr_debug_userlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_EQ(test_output, log);
+}
+
+TEST_F(UserlogTest, TestRingWrap) {
+    /* 100 bytes logs in a 256 bytes ring wrap at the third one */
+    for (char c = 'a'; c < 'h'; ++c) {
+        std::string log(100, c);
+        test_now += 1000ULL;
+        ASSERT_EQ(push(3, log), K_STATUS_OKAY);
+        EXPECT_EQ(mgr_debug_userlog_drain(SIZE_MAX), SECURE_TRUE);
+        EXPECT_EQ(test_output, log);
+        test_output.clear();
+    }
+}
+
+TEST_F(UserlogTest, TestRingFull) {
+    std::string log(CONFIG_DEBUG_USER_LOG_BURST, 'b');
+
+    ASSERT_EQ(push(4, log), K_STATUS_OKAY);
+    ASSERT_EQ(push(5, log), K_STATUS_OKAY);
+    /* ring is full, the log is dropped whatever the task credit */
+    EXPECT_EQ(push(6, "c"), K_ERROR_BUSY);
+    EXPECT_EQ(mgr_debug_userlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_EQ(test_output, log + log);
+}
+
+TEST_F(UserlogTest, TestCreditExhausted) {
+    std::string log(CONFIG_DEBUG_USER_LOG_BURST, 'd');
+
+    ASSERT_EQ(push(7, log), K_STATUS_OKAY);
+    EXPECT_EQ(push(7, "e"), K_ERROR_BUSY);
+    /* 1.024 byte earned */
+    test_now += 1ULL;
+    mgr_debug_userlog_drain(SIZE_MAX);
+    test_output.clear();
+    EXPECT_EQ(push(7, "f"), K_STATUS_OKAY);
+    EXPECT_EQ(mgr_debug_userlog_drain(SIZE_MAX), SECURE_TRUE);
+    EXPECT_EQ(test_output, "[task 0x00000007] 1 log(s) dropped\nf");
+}
+
+TEST_F(UserlogTest, TestFractionalCredit) {
+    std::string log(CONFIG_DEBUG_USER_LOG_BURST, 'g');
+    /* time required to earn a full burst at the configured rate, rounded up */
+    const uint64_t burst_ms = ((CONFIG_DEBUG_USER_LOG_BURST * 1000ULL) + CONFIG_DEBUG_USER_LOG_RATE - 1ULL) /
+                              CONFIG_DEBUG_USER_LOG_RATE;
+
+    ASSERT_EQ(push(8, log), K_STATUS_OKAY);
+    /* refill at each millisecond, the sub-byte part of each refill must be kept */
+    for (uint64_t ms = 0; ms < burst_ms; ++ms) {
+        test_now += 1ULL;
+        ASSERT_EQ(push(8, ""), K_STATUS_OKAY);
+    }
+    EXPECT_EQ(push(8, log), K_STATUS_OKAY);
+}
+
+TEST_F(UserlogTest, TestBurstLimit) {
+    std::string log(CONFIG_DEBUG_USER_LOG_BURST, 'h');
+
+    ASSERT_EQ(push(9, "i"), K_STATUS_OKAY);
+    mgr_debug_userlog_drain(SIZE_MAX);
+    /* a long idle period never earns more than the burst */
+    test_now += 3600000ULL;
+    EXPECT_EQ(push(9, log + "j"), K_ERROR_BUSY);
+    EXPECT_EQ(push(9, log), K_STATUS_OKAY);
+}
+
+TEST_F(UserlogTest, TestTickDrain) {
+    std::string log(100, 'k');
+
+    ASSERT_EQ(push(10, log), K_STATUS_OKAY);
+    for (uint32_t tick = 1; tick < CONFIG_DEBUG_USER_LOG_TICK_PERIOD; ++tick) {
+        mgr_debug_userlog_tick();
+    }
+    EXPECT_TRUE(test_output.empty());
+    mgr_debug_userlog_tick();
+    EXPECT_EQ(test_output, log.substr(0, CONFIG_DEBUG_USER_LOG_DRAIN_CHUNK));
+}
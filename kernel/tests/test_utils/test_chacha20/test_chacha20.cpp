@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include <sentry/zlib/crypto.h>
+
+/* RFC 8439, section 2.3.2, block function test vector */
+TEST(ChaCha20, Rfc8439BlockFunction) {
+    const uint32_t key[8] = {
+        0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c,
+        0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c,
+    };
+    const uint32_t nonce[3] = { 0x09000000, 0x4a000000, 0x00000000 };
+    const uint32_t expected[16] = {
+        0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3,
+        0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3,
+        0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9,
+        0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2,
+    };
+    uint32_t out[16];
+
+    chacha20_block(out, key, 1, nonce);
+    for (size_t i = 0; i < 16; ++i) {
+        ASSERT_EQ(out[i], expected[i]) << "word " << i;
+    }
+}
+
+/* RFC 8439, appendix A.1, test vector #1 (null key, nonce and counter) */
+TEST(ChaCha20, Rfc8439NullKeyKeystream) {
+    const uint32_t key[8] = { 0 };
+    const uint32_t nonce[3] = { 0 };
+    const uint8_t expected[64] = {
+        0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90,
+        0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+        0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a,
+        0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+        0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d,
+        0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+        0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c,
+        0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86,
+    };
+    uint32_t out[16];
+
+    chacha20_block(out, key, 0, nonce);
+    /* keystream is the little endian serialization of the output words */
+    ASSERT_EQ(memcmp(out, expected, sizeof(expected)), 0);
+}
+
+/* consecutive counters must give distinct blocks */
+TEST(ChaCha20, CounterIncrement) {
+    const uint32_t key[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const uint32_t nonce[3] = { 9, 10, 11 };
+    uint32_t out1[16];
+    uint32_t out2[16];
+
+    chacha20_block(out1, key, 41, nonce);
+    chacha20_block(out2, key, 42, nonce);
+    ASSERT_NE(memcmp(out1, out2, sizeof(out1)), 0);
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+ * Host throughput benchmark of the zlib crc32() software implementations.
+ * Host figures only give the relative gain of the algorithms.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+#include "crc32_variants.h"
+
+static constexpr unsigned int loops = 20000;
+
+alignas(8) static uint8_t buf[4096];
+
+static double bench(crc32_fn_t fn, size_t len)
+{
+    volatile uint32_t sink;
+    uint32_t crc = 0xffffffffUL;
+
+    /* warm-up, caches and branch predictors */
+    for (unsigned int i = 0; i < loops / 10; ++i) {
+        crc = fn(buf, len, crc);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < loops; ++i) {
+        crc = fn(buf, len, crc);
+    }
+    auto end = std::chrono::steady_clock::now();
+    sink = crc;
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / loops;
+}
+
+int main(void)
+{
+    /* 4 bytes is the RNG FIPS check case */
+    static const size_t lens[] = { 4, 16, 64, 256, 1024, 4096 };
+
+    for (size_t i = 0; i < sizeof(buf); ++i) {
+        buf[i] = (uint8_t)(i * 7);
+    }
+    printf("%6s", "len");
+    for (auto const &variant : crc32_variants) {
+        printf(" %10s(ns) %8s", variant.name, "MB/s");
+    }
+    printf("\n");
+    for (size_t len : lens) {
+        printf("%6zu", len);
+        for (auto const &variant : crc32_variants) {
+            double ns = bench(variant.fn, len);
+            printf(" %14.1f %8.1f", ns, (double)len * 1000.0 / ns);
+        }
+        printf("\n");
+    }
+    return 0;
+}
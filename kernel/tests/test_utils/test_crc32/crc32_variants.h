@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CRC32_VARIANTS_H
+#define CRC32_VARIANTS_H
+
+#include <cstdint>
+
+/* zlib crc32() built once per software implementation (see meson.build) */
+extern "C" {
+uint32_t crc32_bytewise(unsigned char const * const buf, uint32_t len, uint32_t init);
+uint32_t crc32_slicing4(unsigned char const * const buf, uint32_t len, uint32_t init);
+uint32_t crc32_slicing8(unsigned char const * const buf, uint32_t len, uint32_t init);
+}
+
+typedef uint32_t (*crc32_fn_t)(unsigned char const * const, uint32_t, uint32_t);
+
+struct crc32_variant {
+    const char *name;
+    crc32_fn_t fn;
+};
+
+static const crc32_variant crc32_variants[] = {
+    { "bytewise", crc32_bytewise },
+    { "slicing4", crc32_slicing4 },
+    { "slicing8", crc32_slicing8 },
+};
+
+#endif/*!CRC32_VARIANTS_H*/
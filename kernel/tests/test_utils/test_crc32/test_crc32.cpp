@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <random>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "crc32_variants.h"
+
+/* bit per bit reflected CRC32, no final xor, as the zlib crc32() */
+static uint32_t crc32_reference(uint8_t const *buf, size_t len, uint32_t crc)
+{
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= buf[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xedb88320UL) : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+class Crc32Test : public testing::TestWithParam<crc32_variant> {
+protected:
+    void SetUp() override {
+        std::mt19937 gen(0xc4c);
+        std::uniform_int_distribution<> distrib(0, 255);
+        for (size_t i = 0; i < sizeof(buf); ++i) {
+            buf[i] = (uint8_t)distrib(gen);
+        }
+    }
+
+    alignas(8) uint8_t buf[512];
+};
+
+TEST_P(Crc32Test, CheckValue) {
+    const uint8_t check[] = "123456789";
+    /* standard CRC32 check value is 0xcbf43926, after final xor */
+    EXPECT_EQ(GetParam().fn(check, 9, 0xffffffffUL), (uint32_t)~0xcbf43926UL);
+}
+
+TEST_P(Crc32Test, MatchesReference) {
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t len = 0; len <= sizeof(buf) - 8; len += (len < 64) ? 1 : 37) {
+            ASSERT_EQ(GetParam().fn(&buf[offset], len, 0xffffffffUL),
+                      crc32_reference(&buf[offset], len, 0xffffffffUL))
+                << "offset " << offset << " len " << len;
+        }
+    }
+}
+
+TEST_P(Crc32Test, RandomWord) {
+    /* RNG FIPS check usage */
+    uint32_t random = 0xdeadbeefUL;
+    uint8_t const *bytes = reinterpret_cast<uint8_t const *>(&random);
+    EXPECT_EQ(GetParam().fn(bytes, sizeof(random), 0xffffffffUL),
+              crc32_reference(bytes, sizeof(random), 0xffffffffUL));
+}
+
+TEST_P(Crc32Test, Chaining) {
+    uint32_t crc = GetParam().fn(buf, 13, 0xffffffffUL);
+    crc = GetParam().fn(&buf[13], 200, crc);
+    EXPECT_EQ(crc, GetParam().fn(buf, 213, 0xffffffffUL));
+}
+
+TEST_P(Crc32Test, NullBuffer) {
+    EXPECT_EQ(GetParam().fn(nullptr, 16, 0x42UL), 0x42UL);
+}
+
+INSTANTIATE_TEST_SUITE_P(Crc32, Crc32Test, testing::ValuesIn(crc32_variants),
+                         [](const testing::TestParamInfo<crc32_variant> &info) {
+                             return std::string(info.param.name);
+                         });
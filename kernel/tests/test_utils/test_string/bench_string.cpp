@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+ * Host benchmark of the sentry zlib memset/memcpy against their previous
+ * implementation. Host figures only give the relative gain of the
+ * algorithms (head/tail handling, unrolling), not the target cycle count.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+#include "legacy_string.h"
+
+extern "C" {
+void *sentry_memcpy(void *dest, const void *src, size_t n);
+void *sentry_memset(void *s, int c, unsigned int n);
+}
+
+static constexpr size_t buf_len = 4096 + 8;
+static constexpr unsigned int loops = 20000;
+
+alignas(8) static uint8_t src_buf[buf_len];
+alignas(8) static uint8_t dest_buf[buf_len];
+
+template <typename F>
+static double bench(F &&fn)
+{
+    /* warm-up, caches and branch predictors */
+    for (unsigned int i = 0; i < loops / 10; ++i) {
+        fn();
+        asm volatile("" ::: "memory");
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < loops; ++i) {
+        fn();
+        /* prevent the compiler from eliding the calls */
+        asm volatile("" ::: "memory");
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / loops;
+}
+
+int main(void)
+{
+    static const size_t lens[] = { 16, 64, 256, 1024, 4096 };
+
+    for (size_t i = 0; i < buf_len; ++i) {
+        src_buf[i] = (uint8_t)i;
+    }
+    printf("%-8s %6s %5s %5s %12s %12s %8s\n",
+           "func", "len", "doff", "soff", "legacy(ns)", "sentry(ns)", "speedup");
+    for (size_t len : lens) {
+        for (size_t doff = 0; doff < 4; doff += 3) {
+            double legacy = bench([&] { legacy_memset(&dest_buf[doff], 0, len); });
+            double sentry = bench([&] { sentry_memset(&dest_buf[doff], 0, len); });
+            printf("%-8s %6zu %5zu %5s %12.1f %12.1f %8.2f\n",
+                   "memset", len, doff, "-", legacy, sentry, legacy / sentry);
+        }
+    }
+    for (size_t len : lens) {
+        for (size_t doff = 0; doff < 4; doff += 3) {
+            for (size_t soff = 0; soff < 4; soff += 1) {
+                double legacy = bench([&] { legacy_memcpy(&dest_buf[doff], &src_buf[soff], len); });
+                double sentry = bench([&] { sentry_memcpy(&dest_buf[doff], &src_buf[soff], len); });
+                printf("%-8s %6zu %5zu %5zu %12.1f %12.1f %8.2f\n",
+                       "memcpy", len, doff, soff, legacy, sentry, legacy / sentry);
+            }
+        }
+    }
+    return 0;
+}
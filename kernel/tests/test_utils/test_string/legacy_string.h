@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LEGACY_STRING_H
+#define LEGACY_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Previous sentry zlib memset/memcpy implementations, used as reference for
+ * correctness tests and as baseline for the benchmark.
+ * The word loop of legacy_memcpy() did unaligned word accesses when the
+ * pointers were not aligned, emulated here with an unaligned word type. On
+ * target, these accesses fault as the kernel enables the unaligned access trap.
+ */
+typedef uint32_t __attribute__((aligned(1), may_alias)) legacy_u32_t;
+
+__attribute__((noinline)) static void *legacy_memset(void *s, int c, unsigned int n)
+{
+    char *bytes = static_cast<char*>(s);
+
+    while (n) {
+        *bytes = c;
+        bytes++;
+        n--;
+    }
+    return s;
+}
+
+__attribute__((noinline)) static void *legacy_memcpy(void *dest, const void *src, size_t n)
+{
+    const legacy_u32_t *s = static_cast<const legacy_u32_t*>(src);
+    legacy_u32_t *d = static_cast<legacy_u32_t*>(dest);
+    size_t a = reinterpret_cast<size_t>(dest);
+    size_t b = reinterpret_cast<size_t>(src);
+
+    if ((a < b) && ((a + n) > b)) {
+        return dest;
+    }
+    if ((a > b) && ((b + n) > a)) {
+        return dest;
+    }
+
+    while (n >= 4) {
+        *d = *s;
+        d++;
+        s++;
+        n -= 4;
+    }
+    const uint8_t *s8 = reinterpret_cast<const uint8_t*>(s);
+    uint8_t *d8 = reinterpret_cast<uint8_t*>(d);
+    while (n) {
+        *d8 = *s8;
+        d8++;
+        s8++;
+        n--;
+    }
+    return dest;
+}
+
+#endif/*!LEGACY_STRING_H*/
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#include <random>
+#include <cstring>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "legacy_string.h"
+
+extern "C" {
+void *sentry_memcpy(void *dest, const void *src, size_t n);
+void *sentry_memset(void *s, int c, unsigned int n);
+}
+
+/* room for head/tail misalignment and guard bytes on both sides */
+static constexpr size_t guard = 16;
+static constexpr size_t max_len = 300;
+
+class StringTest : public testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 gen(0x5e7);
+        std::uniform_int_distribution<> distrib(0, 255);
+        for (size_t i = 0; i < sizeof(pattern); ++i) {
+            pattern[i] = (uint8_t)distrib(gen);
+        }
+    }
+
+    alignas(8) uint8_t pattern[max_len + 2 * guard];
+    alignas(8) uint8_t dest[max_len + 2 * guard];
+    alignas(8) uint8_t expected[max_len + 2 * guard];
+};
+
+TEST_F(StringTest, MemsetMatchesLegacy) {
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t len = 0; len <= max_len; ++len) {
+            memcpy(dest, pattern, sizeof(dest));
+            memcpy(expected, pattern, sizeof(expected));
+            legacy_memset(&expected[guard + offset], 0xa5, len);
+            EXPECT_EQ(sentry_memset(&dest[guard + offset], 0xa5, len), &dest[guard + offset]);
+            ASSERT_EQ(memcmp(dest, expected, sizeof(dest)), 0) << "offset " << offset << " len " << len;
+        }
+    }
+}
+
+TEST_F(StringTest, MemsetByteValue) {
+    /* only the low byte of c is used */
+    memset(dest, 0, sizeof(dest));
+    sentry_memset(&dest[guard], 0x1ff, 64);
+    for (size_t i = 0; i < 64; ++i) {
+        ASSERT_EQ(dest[guard + i], 0xff);
+    }
+    EXPECT_EQ(dest[guard - 1], 0);
+    EXPECT_EQ(dest[guard + 64], 0);
+}
+
+TEST_F(StringTest, MemsetNull) {
+    EXPECT_EQ(sentry_memset(nullptr, 0, 16), nullptr);
+}
+
+TEST_F(StringTest, MemcpyMatchesLegacy) {
+    for (size_t doff = 0; doff < 4; ++doff) {
+        for (size_t soff = 0; soff < 4; ++soff) {
+            for (size_t len = 0; len <= max_len - guard; ++len) {
+                memset(dest, 0x5a, sizeof(dest));
+                memset(expected, 0x5a, sizeof(expected));
+                legacy_memcpy(&expected[guard + doff], &pattern[guard + soff], len);
+                EXPECT_EQ(sentry_memcpy(&dest[guard + doff], &pattern[guard + soff], len), &dest[guard + doff]);
+                ASSERT_EQ(memcmp(dest, expected, sizeof(dest)), 0)
+                    << "dest offset " << doff << " src offset " << soff << " len " << len;
+            }
+        }
+    }
+}
+
+TEST_F(StringTest, MemcpyOverlap) {
+    memcpy(dest, pattern, sizeof(dest));
+    memcpy(expected, pattern, sizeof(expected));
+    /* overlapping regions are left untouched, in both directions */
+    EXPECT_EQ(sentry_memcpy(&dest[guard], &dest[guard + 3], 32), &dest[guard]);
+    EXPECT_EQ(sentry_memcpy(&dest[guard + 3], &dest[guard], 32), &dest[guard + 3]);
+    EXPECT_EQ(memcmp(dest, expected, sizeof(dest)), 0);
+    /* contiguous regions do not overlap */
+    sentry_memcpy(&dest[guard], &dest[guard + 32], 32);
+    EXPECT_EQ(memcmp(&dest[guard], &pattern[guard + 32], 32), 0);
+}
+
+TEST_F(StringTest, MemcpyNull) {
+    EXPECT_EQ(sentry_memcpy(nullptr, pattern, 16), nullptr);
+    EXPECT_EQ(sentry_memcpy(dest, nullptr, 16), dest);
+}
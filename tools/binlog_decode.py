@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2024 Ledger SAS
+# SPDX-License-Identifier: Apache-2.0
+
+"""Sentry kernel binary log decoder (CONFIG_DEBUG_BINARY_LOG).
+
+The kernel emits pr_xxx() logs as binary records, mixed with userspace text
+logs on the same debug output:
+
+    | magic (0xff) | payload len (u8) | format id (u16) | payload |
+
+The format identifier is the offset of the format string in the kernel ELF
+.logfmt section. The payload holds the raw arguments, little endian, in format
+string order (see kernel/src/managers/debug/binlog.c). The 0xffff identifier
+is reserved for drop records, holding the number of records dropped by the
+kernel as a u32 payload.
+
+Usage:
+
+    binlog_decode.py sentry-kernel.elf [capture]
+
+The capture is read from stdin if not given, e.g. a raw serial capture or
+`cat /dev/ttyACM0`. Text bytes are forwarded as is.
+"""
+
+import re
+import struct
+import sys
+
+BINLOG_MAGIC = 0xFF
+BINLOG_HEADER_LEN = 4
+BINLOG_DROP_ID = 0xFFFF
+
+FORMAT_SPEC = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d*)(?:\.(?P<prec>\*|\d*))?"
+    r"(?P<len>hh|h|ll|l|z)?(?P<conv>[diouxXcsp%])"
+)
+
+
+class ElfImage:
+    """Kernel ELF file read-only content, using lief."""
+
+    def __init__(self, path):
+        import lief
+
+        binary = lief.parse(path)
+        self.sections = []
+        self.logfmt = None
+        for section in binary.sections:
+            if section.virtual_address == 0 or section.size == 0:
+                continue
+            content = bytes(section.content)
+            self.sections.append((section.virtual_address, content))
+            if section.name == ".logfmt":
+                self.logfmt = (section.virtual_address, content)
+        if self.logfmt is None:
+            raise ValueError("no .logfmt section, kernel not built with CONFIG_DEBUG_BINARY_LOG")
+
+    def read_cstring(self, addr):
+        for base, content in self.sections:
+            if base <= addr < base + len(content):
+                offset = addr - base
+                end = content.find(b"\0", offset)
+                return content[offset:end if end >= 0 else len(content)].decode(errors="replace")
+        return None
+
+    def format_string(self, fmt_id):
+        base, content = self.logfmt
+        return self.read_cstring(base + fmt_id)
+
+
+class BinlogDecoder:
+    """Decode binary log records, using an ElfImage-like string resolver."""
+
+    def __init__(self, image):
+        self.image = image
+
+    def decode_record(self, fmt_id, payload):
+        if fmt_id == BINLOG_DROP_ID:
+            try:
+                (dropped,) = struct.unpack_from("<I", payload, 0)
+            except struct.error:
+                return "<binlog: truncated record>\n"
+            return "<binlog: {} record(s) dropped>\n".format(dropped)
+        fmt = self.image.format_string(fmt_id)
+        if fmt is None:
+            return "<binlog: unknown format id {:#x}>\n".format(fmt_id)
+        out = []
+        pos = 0
+        last = 0
+        try:
+            for spec in FORMAT_SPEC.finditer(fmt):
+                out.append(fmt[last:spec.start()])
+                last = spec.end()
+                conv = spec.group("conv")
+                if conv == "%":
+                    out.append("%")
+                    continue
+                # '*' width and precision are emitted before the argument
+                width = spec.group("width")
+                prec = spec.group("prec")
+                if width == "*":
+                    (width,) = struct.unpack_from("<i", payload, pos)
+                    pos += 4
+                if prec == "*":
+                    (prec,) = struct.unpack_from("<i", payload, pos)
+                    pos += 4
+                    # negative precision is taken as if omitted
+                    prec = None if prec < 0 else prec
+                pyspec = self._pyspec(spec.group("flags"), width, prec)
+                if conv == "s":
+                    (addr,) = struct.unpack_from("<I", payload, pos)
+                    pos += 4
+                    if addr != 0:
+                        string = self.image.read_cstring(addr)
+                        string = string if string is not None else "<{:#010x}>".format(addr)
+                    else:
+                        length = payload[pos]
+                        string = payload[pos + 1:pos + 1 + length].decode(errors="replace")
+                        pos += 1 + length
+                    out.append((pyspec + "s") % string)
+                    continue
+                if spec.group("len") == "ll":
+                    (value,) = struct.unpack_from("<Q", payload, pos)
+                    pos += 8
+                    bits = 64
+                else:
+                    (value,) = struct.unpack_from("<I", payload, pos)
+                    pos += 4
+                    bits = 32
+                out.append(self._format_value(conv, pyspec, value, bits))
+        except (struct.error, IndexError):
+            out.append("<binlog: truncated record>\n")
+            return "".join(out)
+        out.append(fmt[last:])
+        return "".join(out)
+
+    @staticmethod
+    def _pyspec(flags, width, prec):
+        if isinstance(width, int) and width < 0:
+            # negative '*' width is a left adjustment
+            flags += "-"
+            width = -width
+        pyspec = "%" + flags + str(width)
+        if prec is not None:
+            # an empty precision is a null one
+            pyspec += "." + str(prec or 0)
+        return pyspec
+
+    @staticmethod
+    def _format_value(conv, pyspec, value, bits):
+        if conv in "di" and value & (1 << (bits - 1)):
+            value -= 1 << bits
+        if conv == "c":
+            return chr(value & 0xFF)
+        if conv == "p":
+            return "0x{:08x}".format(value)
+        pyconv = "d" if conv in "diu" else conv
+        return (pyspec + pyconv) % value
+
+    def decode_stream(self, data):
+        """Decode a capture, return the text output and the unparsed tail."""
+        out = []
+        text_start = 0
+        pos = 0
+        while pos < len(data):
+            if data[pos] != BINLOG_MAGIC:
+                pos += 1
+                continue
+            if pos + BINLOG_HEADER_LEN > len(data) or pos + BINLOG_HEADER_LEN + data[pos + 1] > len(data):
+                # partial record, kept for the next capture chunk
+                out.append(data[text_start:pos].decode(errors="replace"))
+                return "".join(out), data[pos:]
+            out.append(data[text_start:pos].decode(errors="replace"))
+            length = data[pos + 1]
+            (fmt_id,) = struct.unpack_from("<H", data, pos + 2)
+            payload = data[pos + BINLOG_HEADER_LEN:pos + BINLOG_HEADER_LEN + length]
+            out.append(self.decode_record(fmt_id, payload))
+            pos += BINLOG_HEADER_LEN + length
+            text_start = pos
+        out.append(data[text_start:].decode(errors="replace"))
+        return "".join(out), b""
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        print(__doc__, file=sys.stderr)
+        return 1
+    decoder = BinlogDecoder(ElfImage(argv[1]))
+    stream = open(argv[2], "rb") if len(argv) == 3 else sys.stdin.buffer
+    pending = b""
+    with stream:
+        while True:
+            chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+            if not chunk:
+                break
+            text, pending = decoder.decode_stream(pending + chunk)
+            sys.stdout.write(text)
+            sys.stdout.flush()
+    if pending:
+        sys.stdout.write(pending.decode(errors="replace"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2024 Ledger SAS
+# SPDX-License-Identifier: Apache-2.0
+
+"""PMSAv7 subregion aware memory areas placement.
+
+Without subregions, a PMSAv7 region is a power of two sized area, aligned on its
+size, so that a 40KB task data area consumes 64KB of memory. With the kernel
+CONFIG_MPU_PMSA_V7_SUBREGIONS option set, the kernel maps an area using the
+smallest region whose enabled subregions (1/8 of the region each) cover it. The
+area must then be aligned on the subregion size and must not cross the region
+boundary.
+
+This tool places a set of memory areas (e.g. tasks text or data) in a memory pool
+so that each of them is mappable that way, using the very same algorithm as the
+kernel __mpu_region_pack() function. Areas are placed from the biggest to the
+smallest, at the lowest valid address after the previous one, and may use the
+disabled subregions of previously placed areas.
+
+usage: mpupack.py <pool_origin> <pool_length> <areas.json> [output.json]
+
+areas.json is a {"name": size, ...} dictionary. The output holds, for each area,
+its address, its mapped size, and the MPU region base, size and subregion disable
+mask, and is printed when no output file is given.
+"""
+
+import json
+import sys
+
+PMSAV7_MIN_REGION_SHIFT = 5
+PMSAV7_MIN_SUBREGION_SHIFT = 8
+PMSAV7_MAX_REGION_SHIFT = 32
+PMSAV7_ADDR_ALIGN = 32
+
+
+def region_pack(addr: int, size: int):
+    """Return (base, shift, mask, mapped_start, mapped_end), None if not mappable."""
+    size = max(size, 1 << PMSAV7_MIN_REGION_SHIFT)
+    end = addr + size
+    for shift in range(PMSAV7_MIN_REGION_SHIFT, PMSAV7_MAX_REGION_SHIFT):
+        region = 1 << shift
+        sub = region >> 3
+        base = addr & ~(region - 1)
+        if shift < PMSAV7_MIN_SUBREGION_SHIFT:
+            if base == addr and end <= base + region:
+                return (base, shift, 0, base, base + region)
+            continue
+        if addr & (sub - 1):
+            # subregions only get bigger, no possible mapping
+            return None
+        if end > base + region:
+            continue
+        first = (addr - base) // sub
+        last = (end - base + sub - 1) // sub
+        mask = ~(((1 << last) - 1) & ~((1 << first) - 1)) & 0xFF
+        return (base, shift, mask, base + first * sub, base + last * sub)
+    return None
+
+
+def pow2_size(size: int) -> int:
+    """Legacy mapping size, rounded up to the next power of two."""
+    size = max(size, 1 << PMSAV7_MIN_REGION_SHIFT)
+    return 1 << (size - 1).bit_length()
+
+
+def place(origin: int, length: int, areas: dict) -> dict:
+    placed = {}
+    cursor = origin
+    for name, size in sorted(areas.items(), key=lambda a: a[1], reverse=True):
+        addr = (cursor + PMSAV7_ADDR_ALIGN - 1) & ~(PMSAV7_ADDR_ALIGN - 1)
+        while True:
+            if addr + size > origin + length:
+                raise ValueError(f"{name}: does not fit in memory pool")
+            layout = region_pack(addr, size)
+            if layout is not None:
+                break
+            addr += PMSAV7_ADDR_ALIGN
+        base, shift, mask, start, end = layout
+        placed[name] = {
+            "addr": hex(start),
+            "size": size,
+            "mapped": end - start,
+            "region": {"base": hex(base), "size": 1 << shift, "srd": hex(mask)},
+        }
+        cursor = end
+    return placed
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 4:
+        print(__doc__)
+        sys.exit(1)
+    pool_origin = int(sys.argv[1], 0)
+    pool_length = int(sys.argv[2], 0)
+    with open(sys.argv[3], 'r') as infile:
+        areas = json.load(infile)
+
+    layout = place(pool_origin, pool_length, areas)
+    used = max(int(a["addr"], 16) + a["mapped"] for a in layout.values()) - pool_origin
+    legacy = sum(pow2_size(size) for size in areas.values())
+    if len(sys.argv) == 5:
+        with open(sys.argv[4], 'w') as outfile:
+            json.dump(layout, outfile, indent=2)
+    else:
+        print(json.dumps(layout, indent=2))
+    print(f"pool usage: {used} bytes (power of two mapping: at least {legacy} bytes)",
+          file=sys.stderr)
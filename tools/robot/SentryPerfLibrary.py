@@ -0,0 +1,81 @@
+# SPDX-FileCopyrightText: 2024 Ledger SAS
+# SPDX-License-Identifier: Apache-2.0
+
+"""Sentry autotest performance reports parsing and baseline comparison.
+
+Autotest perf suite emits one machine-readable line per measurement:
+
+    [AT][PERF      ] func:line: name=<name> unit=<unit> samples=<n> min=<v> median=<v> p99=<v> max=<v>
+
+This library parses these lines, stores them as a JSON baseline and
+compares a new run against a stored baseline.
+"""
+
+import json
+import re
+
+from robot.api import logger
+
+PERF_LINE = re.compile(
+    r"\[PERF\s*\]\s+\S+:\d+:\s+name=(?P<name>\S+)\s+unit=(?P<unit>\S+)\s+"
+    r"samples=(?P<samples>\d+)\s+min=(?P<min>\d+)\s+median=(?P<median>\d+)\s+"
+    r"p99=(?P<p99>\d+)\s+max=(?P<max>\d+)"
+)
+
+# max is too noisy (first sample cache effects, ticks) to be gated on
+GATED_METRICS = ("median", "p99")
+
+
+class SentryPerfLibrary:
+    ROBOT_LIBRARY_SCOPE = "SUITE"
+
+    def parse_perf_results(self, log: str) -> dict:
+        """Parse all perf report lines of the given autotest log."""
+        results = {}
+        for line in log.splitlines():
+            match = PERF_LINE.search(line)
+            if match is None:
+                continue
+            entry = match.groupdict()
+            name = entry.pop("name")
+            results[name] = {
+                k: (v if k == "unit" else int(v)) for k, v in entry.items()
+            }
+        return results
+
+    def save_perf_results(self, results: dict, path: str) -> None:
+        """Save perf results as a JSON baseline file."""
+        with open(path, "w") as baseline:
+            json.dump(results, baseline, indent=2, sort_keys=True)
+
+    def compare_perf_results(self, results: dict, path: str, tolerance: str = "10") -> None:
+        """Compare perf results with the given baseline file.
+
+        Fail if any gated metric is higher than its baseline value by more than
+        `tolerance` percent, or if a baseline measurement is missing.
+        New measurements, not in the baseline, are only reported.
+        """
+        with open(path, "r") as baseline_file:
+            baseline = json.load(baseline_file)
+        ratio = 1.0 + float(tolerance) / 100.0
+        regressions = []
+        for name, ref in baseline.items():
+            if name not in results:
+                regressions.append(f"{name}: missing measurement")
+                continue
+            current = results[name]
+            if current["unit"] != ref["unit"]:
+                regressions.append(f"{name}: unit changed ({ref['unit']} -> {current['unit']})")
+                continue
+            for metric in GATED_METRICS:
+                # baseline at 0 (e.g. wake-up error) is compared with a 1 unit margin
+                limit = max(ref[metric] * ratio, ref[metric] + 1)
+                if current[metric] > limit:
+                    regressions.append(
+                        f"{name}: {metric} {current[metric]} > {ref[metric]} {ref['unit']} (+{tolerance}%)"
+                    )
+                logger.info(f"{name}: {metric} {current[metric]} (baseline {ref[metric]}) {ref['unit']}")
+        for name in results.keys() - baseline.keys():
+            logger.warn(f"{name}: not in baseline")
+        if regressions:
+            raise AssertionError("performance regression:\n" + "\n".join(regressions))
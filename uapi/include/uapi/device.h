@@ -16,6 +16,9 @@ extern "C" {
 
 /** device information UAPI types. Variables are jinja-generated from dts */
 
+/** maximum number of interrupts per device, a device declaring more is a build error */
+#define DEVICE_MAX_INTERRUPTS 8U
+
 typedef int (*it_handler_p)(uint16_t it);
 
 typedef struct it_info {
@@ -49,7 +52,7 @@ typedef struct devinfo {
      *  Can be EXTI (button) or NVIC interrupts (SoC device)
      */
     uint8_t num_interrupt;
-    it_info_t its[8];       /**< device interrupt list */
+    it_info_t its[DEVICE_MAX_INTERRUPTS]; /**< device interrupt list */
     uint8_t num_ios;        /**< number of device I/O (pinmux) */
     io_info_t ios[8];       /**< device I/O list */
 } devinfo_t;
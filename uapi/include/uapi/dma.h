@@ -92,6 +92,18 @@ typedef enum gpdma_beat_len {
     GPDMA_BEAT_LEN_WORD = 2,     /**< data len to manipulate is a word */
 } gpdma_beat_len_t;
 
+/**
+ * @enum gpdma_linked_list
+ *
+ * @brief DMA stream linked-list mode, the stream running indefinitely without
+ * software restart
+ */
+typedef enum gpdma_linked_list {
+    GPDMA_LINKED_LIST_NONE          = 0, /**< single block transfer, stopped at transfer complete */
+    GPDMA_LINKED_LIST_CIRCULAR      = 1, /**< the same block is transferred again and again */
+    GPDMA_LINKED_LIST_DOUBLE_BUFFER = 2, /**< memory side alternates between two consecutive buffers */
+} gpdma_linked_list_t;
+
 /**
  * @enum gpdma_priority
  *
@@ -141,6 +153,7 @@ typedef struct gpdma_stream_cfg {
     uint8_t   transfer_mode; /**< DMA transfer mode, @see gpdma_transfer_mode*/
     uint8_t   src_beat_len;  /**< source burst length @see gpdma_beat_len */
     uint8_t   dest_beat_len; /**< source burst length @see gpdma_beat_len */
+    uint8_t   linked_list;   /**< linked-list mode, @see gpdma_linked_list */
 } gpdma_stream_cfg_t;
 
 /**
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UAPI_KINFO_H
+#define UAPI_KINFO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "handle.h"
+
+/**
+ * @file kernel information page declaration and helpers
+ *
+ * When the kernel is built with CONFIG_MM_KINFO_PAGE, a read-only page,
+ * written by the kernel only, is mapped in each task memory layout. Its
+ * address is delivered by sys_get_kinfo_page().
+ *
+ * The time fields are updated at each system tick. Writes are made under a
+ * sequence counter: seq is odd while the kernel updates the page, and is
+ * incremented again once the update is complete. A reader reads seq, the
+ * fields and seq again, and retries if seq was odd or has changed.
+ *
+ * The task directory is set once at boot time, before any task is spawned,
+ * and never changes afterward. It holds the same handles as the ones
+ * delivered by sys_get_process_handle(). Only the first KINFO_MAX_TASKS tasks
+ * are published, if a label is not found, sys_get_process_handle() must be
+ * used instead.
+ */
+
+#define KINFO_PAGE_SIZE 256UL
+#define KINFO_MAGIC     0x4b494e46UL /* "KINF" */
+#define KINFO_MAX_TASKS 16UL
+
+/**
+ * @brief task directory entry
+ */
+typedef struct kinfo_task {
+    uint32_t label;  /**< task label */
+    taskh_t handle;  /**< task handle */
+} kinfo_task_t;
+
+/**
+ * @brief kernel information page content
+ */
+typedef struct kinfo_page {
+    uint32_t seq;             /**< sequence counter, odd while updating */
+    uint32_t magic;           /**< KINFO_MAGIC */
+    uint32_t cycles_per_usec; /**< cycle counter calibration, set at boot time */
+    uint32_t systick_hz;      /**< system tick frequency */
+    uint64_t cycles;          /**< cycle counter at last system tick */
+    uint64_t jiffies;         /**< number of system ticks since boot */
+    uint32_t num_tasks;       /**< number of valid task directory entries */
+    uint32_t reserved;
+    kinfo_task_t tasks[KINFO_MAX_TASKS]; /**< task directory, set at boot time */
+} kinfo_page_t;
+
+static_assert(sizeof(kinfo_page_t) == 168, "invalid kinfo_page_t size");
+static_assert(sizeof(kinfo_page_t) <= KINFO_PAGE_SIZE, "kinfo_page_t exceeds the page size");
+
+/**
+ * @brief read the page time fields consistently
+ *
+ * @param[in] page: kernel information page
+ * @param[out] cycles: cycle counter at last system tick
+ * @param[out] jiffies: number of system ticks since boot
+ */
+static inline void kinfo_read_time(kinfo_page_t const *page, uint64_t *cycles, uint64_t *jiffies)
+{
+    uint32_t seq;
+
+    do {
+        seq = __atomic_load_n(&page->seq, __ATOMIC_ACQUIRE);
+        *cycles = ((volatile kinfo_page_t const *)page)->cycles;
+        *jiffies = ((volatile kinfo_page_t const *)page)->jiffies;
+        /* fields must be read before seq is checked again */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (((seq & 1UL) != 0) || (seq != __atomic_load_n(&page->seq, __ATOMIC_RELAXED)));
+}
+
+/**
+ * @brief elapsed time since boot, in milliseconds, at system tick granularity
+ */
+static inline uint64_t kinfo_get_milliseconds(kinfo_page_t const *page)
+{
+    uint64_t cycles;
+    uint64_t jiffies;
+
+    kinfo_read_time(page, &cycles, &jiffies);
+    return (jiffies * 1000ULL) / page->systick_hz;
+}
+
+/**
+ * @brief elapsed time since boot, in microseconds, at system tick granularity
+ */
+static inline uint64_t kinfo_get_microseconds(kinfo_page_t const *page)
+{
+    uint64_t cycles;
+    uint64_t jiffies;
+
+    kinfo_read_time(page, &cycles, &jiffies);
+    return cycles / page->cycles_per_usec;
+}
+
+/**
+ * @brief lookup a task handle in the page task directory
+ *
+ * @return true if the label has been found, false otherwise
+ */
+static inline bool kinfo_get_task_handle(kinfo_page_t const *page, uint32_t label, taskh_t *handle)
+{
+    bool found = false;
+
+    for (uint32_t i = 0; (i < page->num_tasks) && (i < KINFO_MAX_TASKS); ++i) {
+        if (page->tasks[i].label == label) {
+            *handle = page->tasks[i].handle;
+            found = true;
+            break;
+        }
+    }
+    return found;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif // __cplusplus
+
+#endif/*!UAPI_KINFO_H*/
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UAPI_RING_H
+#define UAPI_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @file SHM producer/consumer ring declaration and helpers
+ *
+ * A shared memory declared with the `outpost,ring` DTS property starts with
+ * a ring header, initialized by the kernel at boot time, followed by the ring
+ * data area. The SHM owner is the producer, the SHM user is the consumer.
+ *
+ * head and tail are free-running byte indexes: head is only written by the
+ * producer, tail is only written by the consumer. The ring fill level is
+ * (head - tail), the data offset of an index is (index & (capacity - 1)).
+ * capacity is a power of two and is never written by tasks.
+ *
+ * Once data has been pushed (resp. popped), the producer (resp. consumer)
+ * rings the kernel doorbell (sys_shm_ring_doorbell()), which wakes the peer up
+ * with a SIGNAL_POLL signal only when needed.
+ */
+
+/**
+ * @brief SHM ring header, located at the SHM base address
+ */
+typedef struct shm_ring {
+    uint32_t head;      /**< producer index, in bytes, free-running */
+    uint32_t tail;      /**< consumer index, in bytes, free-running */
+    uint32_t capacity;  /**< data area length in bytes, power of two, set by the kernel */
+    uint32_t watermark; /**< consumer wake-up fill level, 0 if not set, set by the kernel */
+} shm_ring_t;
+
+static_assert(sizeof(shm_ring_t) == 16, "invalid shm_ring_t size");
+
+/**
+ * @brief ring data area, following the ring header
+ */
+static inline uint8_t *shm_ring_data(shm_ring_t *ring)
+{
+    return (uint8_t*)ring + sizeof(shm_ring_t);
+}
+
+/**
+ * @brief number of bytes that can be popped from the ring
+ */
+static inline uint32_t shm_ring_fill(shm_ring_t const *ring)
+{
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+/**
+ * @brief number of bytes that can be pushed to the ring
+ */
+static inline uint32_t shm_ring_space(shm_ring_t const *ring)
+{
+    return ring->capacity - shm_ring_fill(ring);
+}
+
+/**
+ * @brief push up to len bytes in the ring (producer side)
+ *
+ * @return the number of bytes effectively pushed, limited by the ring space
+ */
+static inline size_t shm_ring_push(shm_ring_t *ring, uint8_t const *buf, size_t len)
+{
+    uint8_t *data = shm_ring_data(ring);
+    uint32_t mask = ring->capacity - 1UL;
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t space = ring->capacity - (head - tail);
+
+    if (len > space) {
+        len = space;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        data[(head + i) & mask] = buf[i];
+    }
+    /* data must be visible before the index update */
+    __atomic_store_n(&ring->head, head + (uint32_t)len, __ATOMIC_RELEASE);
+    return len;
+}
+
+/**
+ * @brief pop up to len bytes from the ring (consumer side)
+ *
+ * @return the number of bytes effectively popped, limited by the ring fill level
+ */
+static inline size_t shm_ring_pop(shm_ring_t *ring, uint8_t *buf, size_t len)
+{
+    uint8_t const *data = shm_ring_data(ring);
+    uint32_t mask = ring->capacity - 1UL;
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t fill = head - tail;
+
+    if (len > fill) {
+        len = fill;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        buf[i] = data[(tail + i) & mask];
+    }
+    /* data must be read before the slots are released to the producer */
+    __atomic_store_n(&ring->tail, tail + (uint32_t)len, __ATOMIC_RELEASE);
+    return len;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif // __cplusplus
+
+#endif/*!UAPI_RING_H*/
@@ -54,6 +54,41 @@ typedef enum Precision {
   PRECISION_MILLISECONDS,
 } Precision;
 
+/**
+ * Kernel statistics that can be read back using sys_get_kernel_stat()
+ * (debug and autotest builds only)
+ */
+typedef enum KernelStat {
+  /**
+   * Kernel handlers masked window, in cycles
+   */
+  KERNEL_STAT_MASKED_WINDOW,
+  /**
+   * Syscall gate execution, in cycles. Indexed by Syscall identifier
+   */
+  KERNEL_STAT_SYSCALL,
+  /**
+   * Systick handler execution, in cycles
+   */
+  KERNEL_STAT_SYSTICK,
+  /**
+   * User interrupts (device and DMA) kernel handler execution, in cycles
+   */
+  KERNEL_STAT_USER_IRQ,
+  /**
+   * Latency probe trigger to kernel handler entry, in cycles
+   */
+  KERNEL_STAT_IRQ_PROBE_ENTRY,
+  /**
+   * Latency probe kernel handler entry to owner wait_for_event() return, in cycles
+   */
+  KERNEL_STAT_IRQ_PROBE_WAKEUP,
+  /**
+   * Task layout MPU load, at each kernel handler exit, in cycles
+   */
+  KERNEL_STAT_MPU_LOAD,
+} KernelStat;
+
 /**
  * List of Sentry resource types
  *
@@ -84,6 +119,12 @@ typedef enum SHMPermission {
    * allows target process to transfer SHM to another, pre-allowed, process
    */
   SHM_PERMISSION_TRANSFER = 1 << 3,
+  /**
+   * declare target process as an additional read-only reader of the SHM.
+   * Only MAP and READ can be combined with READER. READER without MAP
+   * removes the target reader.
+   */
+  SHM_PERMISSION_READER = 1 << 4,
 } SHMPermission;
 
 /**
@@ -186,6 +227,20 @@ typedef enum AlarmFlag {
   O_ALRM_STOP,
 } AlarmFlag;
 
+/**
+ * SHM ring doorbell event, see uapi/ring.h
+ */
+typedef enum ShmRingEvent {
+  /**
+   * Data has been pushed by the producer (SHM owner)
+   */
+  SHM_RING_PRODUCED,
+  /**
+   * Data has been popped by the consumer (SHM user)
+   */
+  SHM_RING_CONSUMED,
+} ShmRingEvent;
+
 /**
  * Sentry syscall return values
  * NonSense must never be returned, as it means that an
@@ -248,6 +303,17 @@ typedef enum Syscall {
   SYSCALL_DMA_UNASSIGN_STREAM,
   SYSCALL_DMA_GET_STREAM_INFO,
   SYSCALL_DMA_RESUME_STREAM,
+  SYSCALL_GET_KERNEL_STAT,
+  SYSCALL_TRIGGER_IRQ_PROBE,
+  SYSCALL_SHM_CACHE_CLEAN,
+  SYSCALL_SHM_CACHE_INVALIDATE,
+  SYSCALL_SHM_RING_DOORBELL,
+  SYSCALL_SEND_IPC_SHM,
+  SYSCALL_SHM_DMA_ALLOC,
+  SYSCALL_SHM_DMA_FREE,
+  SYSCALL_SHM_COPY,
+  SYSCALL_GET_RANDOM_BUFFER,
+  SYSCALL_GET_KINFO_PAGE,
 } Syscall;
 
 /**
@@ -305,6 +371,24 @@ typedef struct shm_infos {
     uint32_t perms;   /*< SHM permissions (mask of SHMPermission) */
 } shm_infos_t;
 
+/* SHM to SHM copy descriptor, set in the SVC exchange area before sys_shm_copy() */
+typedef struct shm_copy {
+    shmh_t   src;        /*< source SHM handle */
+    uint32_t src_offset; /*< source offset in bytes, from the source SHM base address */
+    shmh_t   dst;        /*< destination SHM handle */
+    uint32_t dst_offset; /*< destination offset in bytes, from the destination SHM base address */
+    uint32_t len;        /*< copy length in bytes */
+} shm_copy_t;
+
+/* kernel statistic data structure, values in cycles */
+typedef struct kernel_stat_infos {
+    uint64_t total;  /*< sum of all the recorded values */
+    uint32_t count;  /*< number of recorded values */
+    uint32_t min;    /*< minimum recorded value */
+    uint32_t max;    /*< maximum recorded value */
+    uint32_t last;   /*< last recorded value */
+} kernel_stat_infos_t;
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif // __cplusplus
@@ -24,6 +24,7 @@
 #include <stdbool.h>
 #include "handle.h"
 #include "types.h"
+#include "kinfo.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -194,6 +195,13 @@ Status __sys_map_shm(shmh_t shm);
  */
 Status __sys_send_ipc(uint32_t resource, uint8_t length);
 
+/**
+ * Send events to another process, transferring the given SHM user credentials
+ * to it. The SHM is unmapped from the sender and mapped in the target if the
+ * transferred credentials allow it.
+ */
+Status __sys_send_ipc_shm(uint32_t resource, uint8_t length, shmh_t shm);
+
 /**
  * Send a signal to another process
  */
@@ -285,6 +293,76 @@ Status __sys_dma_get_stream_status(dmah_t stream);
 
 Status __sys_dma_get_stream_info(dmah_t stream);
 
+/**
+ * Get back a kernel statistic (kernel_stat_infos_t) in the SVC exchange area.
+ * Requires CAP_SYS_DEBUG. Statistics are not recorded in release builds.
+ */
+Status __sys_get_kernel_stat(KernelStat stat, uint32_t index);
+
+/**
+ * Trigger the kernel EXTI interrupt latency probe, after the given number of
+ * ticks (0: at syscall exit). The probe interrupt is then received with
+ * __sys_wait_for_event(EVENT_TYPE_IRQ, ...). Requires CAP_SYS_DEBUG.
+ */
+Status __sys_trigger_irq_probe(uint32_t ticks);
+
+/**
+ * Write back the data cache content of the given cacheable SHM range, so that
+ * a DMA stream reading the SHM gets the data written by the task.
+ */
+Status __sys_shm_cache_clean(shmh_t shm, size_t offset, size_t len);
+
+/**
+ * Discard the data cache content of the given cacheable SHM range, so that the
+ * task reads the data written by a DMA stream. Requires SHM write permission.
+ */
+Status __sys_shm_cache_invalidate(shmh_t shm, size_t offset, size_t len);
+
+/**
+ * Ring the doorbell of the given SHM ring (see uapi/ring.h) once data has been
+ * produced or consumed. The peer is sent SIGNAL_POLL only when the ring leaves
+ * the empty (or full) state, or crosses the DTS defined watermark.
+ */
+Status __sys_shm_ring_doorbell(shmh_t shm, ShmRingEvent event);
+
+/**
+ * Allocate a buffer of at least len bytes in the given DMA pool SHM. The buffer
+ * offset, relative to the SHM base address and aligned on the DTS defined DMA
+ * pool block size, is set in the SVC exchange area.
+ */
+Status __sys_shm_dma_alloc(shmh_t shm, size_t len);
+
+/**
+ * Release a buffer previously allocated by the calling task in the given DMA
+ * pool SHM, identified by its offset.
+ */
+Status __sys_shm_dma_free(shmh_t shm, size_t offset);
+
+/**
+ * Copy data from a SHM to another one using the kernel DMA copy service. The
+ * shm_copy_t copy descriptor must have been set in the SVC exchange area
+ * (copy_to_kernel()) before the call.
+ */
+Status __sys_shm_copy(void);
+
+/**
+ * Fill the first len bytes of the SVC exchange area with random values. len
+ * must not exceed the SVC exchange area size.
+ */
+Status __sys_get_random_buffer(uint32_t len);
+
+/**
+ * Set the kernel information page address in the SVC exchange area. Prefer
+ * kinfo_get_page(), which caches it.
+ */
+Status __sys_get_kinfo_page(void);
+
+/**
+ * Return the kernel information page, mapped read-only in all tasks, or NULL
+ * if the kernel is built without it. See kinfo.h for the page read helpers.
+ */
+const kinfo_page_t *kinfo_get_page(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif // __cplusplus
@@ -1,7 +1,8 @@
 // SPDX-FileCopyrightText: 2023 Ledger SAS
 // SPDX-License-Identifier: Apache-2.0
 
-use crate::systypes::shm::ShmInfo;
+use crate::systypes::kstat::KernelStatInfo;
+use crate::systypes::shm::{ShmCopy, ShmInfo};
 use crate::systypes::{ExchangeHeader, Status};
 use core::ptr::*;
 
@@ -76,6 +77,81 @@ impl SentryExchangeable for crate::systypes::shm::ShmInfo {
     }
 }
 
+/// SentryExchangeable trait implementation for KernelStatInfo.
+/// KernelStatInfo is returned by the kernel when reading back a kernel
+/// statistic. As for ShmInfo, it can be written back to the exchange
+/// area in test mode only.
+///
+impl SentryExchangeable for crate::systypes::kstat::KernelStatInfo {
+    #[allow(static_mut_refs)]
+    fn from_kernel(&mut self) -> Result<Status, Status> {
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                EXCHANGE_AREA.as_ptr(),
+                addr_of_mut!(*self) as *mut u8,
+                core::mem::size_of::<KernelStatInfo>().min(EXCHANGE_AREA_LEN),
+            );
+        }
+        Ok(Status::Ok)
+    }
+
+    #[cfg(test)]
+    #[allow(static_mut_refs)]
+    fn to_kernel(&self) -> Result<Status, Status> {
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                addr_of!(*self) as *const u8,
+                EXCHANGE_AREA.as_mut_ptr(),
+                core::mem::size_of::<KernelStatInfo>().min(EXCHANGE_AREA_LEN),
+            );
+        }
+        Ok(Status::Ok)
+    }
+
+    #[cfg(not(test))]
+    #[allow(static_mut_refs)]
+    fn to_kernel(&self) -> Result<Status, Status> {
+        Err(Status::Invalid)
+    }
+}
+
+/// SentryExchangeable trait implementation for ShmCopy.
+/// ShmCopy is a copy descriptor written by the task in the exchange area
+/// before calling [`crate::syscall::shm_copy`]. The kernel never writes it
+/// back, so that it can be read from the exchange area in test mode only.
+///
+impl SentryExchangeable for crate::systypes::shm::ShmCopy {
+    #[cfg(test)]
+    #[allow(static_mut_refs)]
+    fn from_kernel(&mut self) -> Result<Status, Status> {
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                EXCHANGE_AREA.as_ptr(),
+                addr_of_mut!(*self) as *mut u8,
+                core::mem::size_of::<ShmCopy>().min(EXCHANGE_AREA_LEN),
+            );
+        }
+        Ok(Status::Ok)
+    }
+
+    #[cfg(not(test))]
+    fn from_kernel(&mut self) -> Result<Status, Status> {
+        Err(Status::Invalid)
+    }
+
+    #[allow(static_mut_refs)]
+    fn to_kernel(&self) -> Result<Status, Status> {
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                addr_of!(*self) as *const u8,
+                EXCHANGE_AREA.as_mut_ptr(),
+                core::mem::size_of::<ShmCopy>().min(EXCHANGE_AREA_LEN),
+            );
+        }
+        Ok(Status::Ok)
+    }
+}
+
 // from-exchange related capacity to Exchang header
 impl ExchangeHeader {
     unsafe fn from_addr(self, address: usize) -> &'static Self {
@@ -325,6 +401,48 @@ mod tests {
         assert_eq!(src, dst);
     }
 
+    #[test]
+    fn back_to_back_kernel_stat() {
+        let src = KernelStatInfo {
+            total: 0x1_0000_0042,
+            count: 12,
+            min: 3,
+            max: 420,
+            last: 42,
+        };
+        let mut dst = KernelStatInfo {
+            total: 0,
+            count: 0,
+            min: 0,
+            max: 0,
+            last: 0,
+        };
+        let _ = src.to_kernel();
+        let _ = dst.from_kernel();
+        assert_eq!(src, dst);
+    }
+
+    #[test]
+    fn back_to_back_shm_copy() {
+        let src = ShmCopy {
+            src: 2,
+            src_offset: 0x40,
+            dst: 3,
+            dst_offset: 0,
+            len: 0x200,
+        };
+        let mut dst = ShmCopy {
+            src: 0,
+            src_offset: 0,
+            dst: 0,
+            dst_offset: 0,
+            len: 0,
+        };
+        assert_eq!(src.to_kernel(), Ok(Status::Ok));
+        assert_eq!(dst.from_kernel(), Ok(Status::Ok));
+        assert_eq!(src, dst);
+    }
+
     #[test]
     fn back_to_back_event() {
         let src = crate::systypes::Event {
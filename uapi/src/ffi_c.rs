@@ -86,6 +86,12 @@ pub extern "C" fn __sys_send_ipc(target: TaskHandle, length: u8) -> Status {
     crate::syscall::send_ipc(target, length)
 }
 
+/// C interface to [`crate::syscall::send_ipc_shm`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_send_ipc_shm(target: TaskHandle, length: u8, shm: ShmHandle) -> Status {
+    crate::syscall::send_ipc_shm(target, length, shm)
+}
+
 /// C interface to [`crate::syscall::send_signal`] syscall Rust implementation
 #[no_mangle]
 pub extern "C" fn __sys_send_signal(resource: u32, signal_type: Signal) -> Status {
@@ -236,6 +242,81 @@ pub extern "C" fn __sys_dma_resume_stream(dmah: StreamHandle) -> Status {
     crate::syscall::dma_resume_stream(dmah)
 }
 
+/// C interface to [`crate::syscall::get_kernel_stat`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_get_kernel_stat(stat: KernelStat, index: u32) -> Status {
+    crate::syscall::get_kernel_stat(stat, index)
+}
+
+/// C interface to [`crate::syscall::trigger_irq_probe`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_trigger_irq_probe(ticks: u32) -> Status {
+    crate::syscall::trigger_irq_probe(ticks)
+}
+
+/// C interface to [`crate::syscall::shm_cache_clean`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_cache_clean(shm: ShmHandle, offset: usize, length: usize) -> Status {
+    crate::syscall::shm_cache_clean(shm, offset, length)
+}
+
+/// C interface to [`crate::syscall::shm_cache_invalidate`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_cache_invalidate(
+    shm: ShmHandle,
+    offset: usize,
+    length: usize,
+) -> Status {
+    crate::syscall::shm_cache_invalidate(shm, offset, length)
+}
+
+/// C interface to [`crate::syscall::shm_ring_doorbell`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_ring_doorbell(shm: ShmHandle, event: ShmRingEvent) -> Status {
+    crate::syscall::shm_ring_doorbell(shm, event)
+}
+
+/// C interface to [`crate::syscall::shm_dma_alloc`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_dma_alloc(shm: ShmHandle, length: usize) -> Status {
+    crate::syscall::shm_dma_alloc(shm, length)
+}
+
+/// C interface to [`crate::syscall::shm_dma_free`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_dma_free(shm: ShmHandle, offset: usize) -> Status {
+    crate::syscall::shm_dma_free(shm, offset)
+}
+
+/// C interface to [`crate::syscall::shm_copy`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_shm_copy() -> Status {
+    crate::syscall::shm_copy()
+}
+
+/// C interface to [`crate::syscall::get_random_buffer`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_get_random_buffer(length: u32) -> Status {
+    crate::syscall::get_random_buffer(length as usize)
+}
+
+/// C interface to [`crate::syscall::get_kinfo_page`] syscall Rust implementation
+#[no_mangle]
+pub extern "C" fn __sys_get_kinfo_page() -> Status {
+    crate::syscall::get_kinfo_page()
+}
+
+/// C interface to [`crate::kinfo::page`] Rust implementation
+///
+/// Returns NULL if the kernel information page is not available.
+#[no_mangle]
+pub extern "C" fn kinfo_get_page() -> *const crate::systypes::kinfo::KinfoPage {
+    match crate::kinfo::page() {
+        Some(kinfo) => kinfo.as_ptr(),
+        None => core::ptr::null(),
+    }
+}
+
 /// C interface to [`crate::copy_to_kernel`] Rust implementation
 #[no_mangle]
 pub extern "C" fn copy_to_kernel(from: *mut u8, length: usize) -> Status {
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+use crate::exchange;
+use crate::systypes::kinfo::{KinfoPage, KINFO_MAGIC, KINFO_MAX_TASKS};
+use crate::systypes::{Status, TaskHandle, TaskLabel};
+use core::sync::atomic::{fence, AtomicU32, AtomicUsize, Ordering};
+
+/// Kernel information page address, 0 until first successfully requested
+static PAGE_ADDR: AtomicUsize = AtomicUsize::new(0);
+
+/// Kernel information page, mapped read-only in the task
+///
+/// The page is updated by the kernel at each system tick, behind the task
+/// back. It is thus never accessed through a Rust reference, but only using
+/// volatile reads of its fields, through a raw pointer.
+#[derive(Clone, Copy)]
+pub struct Kinfo {
+    page: *const KinfoPage,
+}
+
+/// Volatile read of a kernel information page field
+macro_rules! kinfo_read {
+    ($kinfo:expr, $($field:tt)+) => {
+        // SAFETY: the page pointer is valid (see Kinfo::from_ptr), and read
+        // only through raw pointers, as written by the kernel
+        unsafe { core::ptr::read_volatile(core::ptr::addr_of!((*$kinfo.page).$($field)+)) }
+    };
+}
+
+/// Get the kernel information page
+///
+/// The page address is requested once using [`crate::syscall::get_kinfo_page`]
+/// and then cached. Returns None if the kernel is built without the
+/// information page.
+pub fn page() -> Option<Kinfo> {
+    let mut addr = PAGE_ADDR.load(Ordering::Relaxed);
+    if addr == 0 {
+        if crate::syscall::get_kinfo_page() != Status::Ok {
+            return None;
+        }
+        let mut raw: [u8; 4] = [0; 4];
+        exchange::copy_from_kernel(&mut raw.as_mut_slice()).ok()?;
+        addr = u32::from_ne_bytes(raw) as usize;
+        if addr == 0 {
+            return None;
+        }
+        PAGE_ADDR.store(addr, Ordering::Relaxed);
+    }
+    // SAFETY: the kernel maps the page read-only in all tasks at boot time,
+    // for the whole task lifetime
+    let kinfo = unsafe { Kinfo::from_ptr(addr as *const KinfoPage) };
+    if kinfo_read!(kinfo, magic) != KINFO_MAGIC {
+        return None;
+    }
+    Some(kinfo)
+}
+
+impl Kinfo {
+    /// # Safety
+    ///
+    /// page must be valid for reads, and aligned, for the whole Kinfo lifetime
+    unsafe fn from_ptr(page: *const KinfoPage) -> Self {
+        Kinfo { page }
+    }
+
+    /// Kernel information page raw pointer
+    pub fn as_ptr(&self) -> *const KinfoPage {
+        self.page
+    }
+
+    fn seq(&self) -> &AtomicU32 {
+        // SAFETY: AtomicU32 has the same layout as u32, and its interior
+        // mutability allows the kernel updates
+        unsafe { &*(core::ptr::addr_of!((*self.page).seq) as *const AtomicU32) }
+    }
+
+    /// Read the cycle counter and the number of ticks at last system tick
+    ///
+    /// Both values are read consistently, retrying while the kernel is
+    /// updating them.
+    pub fn time(&self) -> (u64, u64) {
+        loop {
+            let seq = self.seq().load(Ordering::Acquire);
+            let cycles = kinfo_read!(self, cycles);
+            let jiffies = kinfo_read!(self, jiffies);
+            // fields must be read before seq is checked again
+            fence(Ordering::Acquire);
+            if seq & 1 == 0 && seq == self.seq().load(Ordering::Relaxed) {
+                return (cycles, jiffies);
+            }
+        }
+    }
+
+    /// Elapsed time since boot, in milliseconds, at system tick granularity
+    pub fn milliseconds(&self) -> u64 {
+        let (_, jiffies) = self.time();
+        (jiffies * 1000) / u64::from(kinfo_read!(self, systick_hz))
+    }
+
+    /// Elapsed time since boot, in microseconds, at system tick granularity
+    pub fn microseconds(&self) -> u64 {
+        let (cycles, _) = self.time();
+        cycles / u64::from(kinfo_read!(self, cycles_per_usec))
+    }
+
+    /// Lookup a task handle in the task directory
+    ///
+    /// Returns None if the label is not published, in which case
+    /// [`crate::syscall::get_process_handle`] must be used instead.
+    pub fn task_handle(&self, label: TaskLabel) -> Option<TaskHandle> {
+        let num = core::cmp::min(kinfo_read!(self, num_tasks) as usize, KINFO_MAX_TASKS);
+        (0..num)
+            .map(|i| kinfo_read!(self, tasks[i]))
+            .find(|task| task.label == label)
+            .map(|task| task.handle)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::systypes::kinfo::KinfoTask;
+
+    fn forge_page() -> KinfoPage {
+        let mut page = KinfoPage {
+            seq: 42,
+            magic: KINFO_MAGIC,
+            cycles_per_usec: 64,
+            systick_hz: 1000,
+            cycles: 96_000_000,
+            jiffies: 1500,
+            num_tasks: 2,
+            reserved: 0,
+            tasks: [KinfoTask {
+                label: 0,
+                handle: 0,
+            }; KINFO_MAX_TASKS],
+        };
+        page.tasks[0] = KinfoTask {
+            label: 0xbabe,
+            handle: 0x1234_0001,
+        };
+        page.tasks[1] = KinfoTask {
+            label: 0xcafe,
+            handle: 0x5678_0002,
+        };
+        page
+    }
+
+    #[test]
+    fn time() {
+        let page = forge_page();
+        let kinfo = unsafe { Kinfo::from_ptr(&page) };
+        assert_eq!(kinfo.time(), (96_000_000, 1500));
+        assert_eq!(kinfo.milliseconds(), 1500);
+        assert_eq!(kinfo.microseconds(), 1_500_000);
+    }
+
+    #[test]
+    fn task_handle() {
+        let mut page = forge_page();
+        let kinfo = unsafe { Kinfo::from_ptr(&page) };
+        assert_eq!(kinfo.task_handle(0xcafe), Some(0x5678_0002));
+        assert_eq!(kinfo.task_handle(0xdead), None);
+        // entries above num_tasks are not published
+        page.num_tasks = 1;
+        let kinfo = unsafe { Kinfo::from_ptr(&page) };
+        assert_eq!(kinfo.task_handle(0xcafe), None);
+    }
+}
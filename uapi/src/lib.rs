@@ -101,6 +101,30 @@ pub mod syscall;
 ///
 pub mod systypes;
 
+/// Shared memory producer/consumer ring helpers
+///
+/// # Usage
+///
+/// Shared memories declared with the `outpost,ring` DTS property start with a
+/// [`systypes::shm::ShmRing`] header, initialized by the kernel, followed by
+/// the ring data area. This module delivers the lock-free producer and consumer
+/// primitives on such a ring. Peer notification is made through the
+/// [`syscall::shm_ring_doorbell`] syscall.
+///
+pub mod ring;
+
+/// Kernel information page helpers
+///
+/// # Usage
+///
+/// When the kernel is built with CONFIG_MM_KINFO_PAGE, a
+/// [`systypes::kinfo::KinfoPage`] is mapped read-only in all tasks. It delivers
+/// the system tick based time and the task handles directory as plain memory
+/// reads, through [`kinfo::Kinfo`], instead of [`syscall::get_cycle`] and
+/// [`syscall::get_process_handle`] syscalls.
+///
+pub mod kinfo;
+
 /// Copy a given generic type from the kernel exchange zone to the given mutable reference
 pub use self::exchange::copy_from_kernel;
 
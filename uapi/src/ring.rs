@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2024 Ledger SAS
+// SPDX-License-Identifier: Apache-2.0
+
+use crate::systypes::shm::ShmRing;
+use core::sync::atomic::{AtomicU32, Ordering};
+
+const HEADER_LEN: usize = core::mem::size_of::<ShmRing>();
+
+/// Producer/consumer view of a shared memory ring
+///
+/// head and tail are free-running byte indexes. head is only written by the
+/// producer, tail is only written by the consumer, so that a single producer
+/// and a single consumer never need any lock. Each index update is made
+/// with a release store after the data access, and each peer index is read with
+/// an acquire load before the data access.
+pub struct Ring {
+    header: *mut ShmRing,
+}
+
+impl Ring {
+    /// Build a ring view from the shared memory base address
+    ///
+    /// # Safety
+    ///
+    /// `base` must be the base address of a mapped shared memory declared with
+    /// the `outpost,ring` DTS property, so that the kernel has initialized the
+    /// ring header.
+    pub unsafe fn from_raw(base: *mut u8) -> Self {
+        Ring {
+            header: base as *mut ShmRing,
+        }
+    }
+
+    fn head(&self) -> &AtomicU32 {
+        // SAFETY: header is valid as per from_raw() contract, AtomicU32 has
+        // the same layout as u32
+        unsafe { &*(core::ptr::addr_of_mut!((*self.header).head) as *const AtomicU32) }
+    }
+
+    fn tail(&self) -> &AtomicU32 {
+        // SAFETY: see head()
+        unsafe { &*(core::ptr::addr_of_mut!((*self.header).tail) as *const AtomicU32) }
+    }
+
+    fn data(&self) -> *mut u8 {
+        // SAFETY: the data area follows the header in the same shared memory
+        unsafe { (self.header as *mut u8).add(HEADER_LEN) }
+    }
+
+    /// Ring data area length in bytes
+    pub fn capacity(&self) -> u32 {
+        // SAFETY: capacity is only written by the kernel, at boot time
+        unsafe { core::ptr::read_volatile(core::ptr::addr_of!((*self.header).capacity)) }
+    }
+
+    /// Number of bytes that can be popped from the ring
+    pub fn fill(&self) -> u32 {
+        let head = self.head().load(Ordering::Acquire);
+        let tail = self.tail().load(Ordering::Acquire);
+        head.wrapping_sub(tail)
+    }
+
+    /// Number of bytes that can be pushed to the ring
+    pub fn space(&self) -> u32 {
+        self.capacity().wrapping_sub(self.fill())
+    }
+
+    /// Push as many bytes of `buf` as possible (producer side)
+    ///
+    /// Returns the number of bytes effectively pushed.
+    pub fn push(&mut self, buf: &[u8]) -> usize {
+        let capacity = self.capacity();
+        let mask = capacity.wrapping_sub(1);
+        let head = self.head().load(Ordering::Relaxed);
+        let tail = self.tail().load(Ordering::Acquire);
+        let space = capacity.wrapping_sub(head.wrapping_sub(tail)) as usize;
+        let len = core::cmp::min(buf.len(), space);
+        let data = self.data();
+        for (i, byte) in buf[..len].iter().enumerate() {
+            let offset = (head.wrapping_add(i as u32) & mask) as usize;
+            // SAFETY: offset is lower than capacity, data area is capacity long
+            unsafe { core::ptr::write_volatile(data.add(offset), *byte) };
+        }
+        self.head()
+            .store(head.wrapping_add(len as u32), Ordering::Release);
+        len
+    }
+
+    /// Pop as many bytes as possible into `buf` (consumer side)
+    ///
+    /// Returns the number of bytes effectively popped.
+    pub fn pop(&mut self, buf: &mut [u8]) -> usize {
+        let mask = self.capacity().wrapping_sub(1);
+        let tail = self.tail().load(Ordering::Relaxed);
+        let head = self.head().load(Ordering::Acquire);
+        let fill = head.wrapping_sub(tail) as usize;
+        let len = core::cmp::min(buf.len(), fill);
+        let data = self.data();
+        for (i, byte) in buf[..len].iter_mut().enumerate() {
+            let offset = (tail.wrapping_add(i as u32) & mask) as usize;
+            // SAFETY: see push()
+            *byte = unsafe { core::ptr::read_volatile(data.add(offset)) };
+        }
+        self.tail()
+            .store(tail.wrapping_add(len as u32), Ordering::Release);
+        len
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// emulate the kernel ring initialization in a 4-byte aligned buffer
+    fn ring_init(mem: &mut [u32], capacity: u32) -> Ring {
+        mem[0] = 0;
+        mem[1] = 0;
+        mem[2] = capacity;
+        mem[3] = 0;
+        unsafe { Ring::from_raw(mem.as_mut_ptr() as *mut u8) }
+    }
+
+    #[test]
+    fn push_pop_wrap() {
+        let mut mem = [0u32; 4 + 4];
+        let mut ring = ring_init(&mut mem, 16);
+        let mut out = [0u8; 16];
+
+        assert_eq!(ring.push(&[1, 2, 3, 4, 5, 6, 7, 8, 9, 10]), 10);
+        assert_eq!(ring.fill(), 10);
+        assert_eq!(ring.pop(&mut out[..8]), 8);
+        assert_eq!(out[..8], [1, 2, 3, 4, 5, 6, 7, 8]);
+        /* crosses the data area end */
+        assert_eq!(ring.push(&[11, 12, 13, 14, 15, 16, 17, 18, 19, 20]), 10);
+        assert_eq!(ring.fill(), 12);
+        assert_eq!(ring.space(), 4);
+        assert_eq!(ring.pop(&mut out), 12);
+        assert_eq!(out[..12], [9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20]);
+        assert_eq!(ring.fill(), 0);
+    }
+
+    #[test]
+    fn push_full_pop_empty() {
+        let mut mem = [0u32; 4 + 2];
+        let mut ring = ring_init(&mut mem, 8);
+        let mut out = [0u8; 4];
+
+        assert_eq!(ring.push(&[0xa5; 12]), 8);
+        assert_eq!(ring.space(), 0);
+        assert_eq!(ring.push(&[0x5a]), 0);
+        assert_eq!(ring.pop(&mut out), 4);
+        assert_eq!(ring.pop(&mut out), 4);
+        assert_eq!(ring.pop(&mut out), 0);
+        assert_eq!(out, [0xa5; 4]);
+    }
+
+    #[test]
+    fn index_overflow() {
+        let mut mem = [0u32; 4 + 2];
+        /* free-running indexes close to u32 wrap */
+        mem[0] = u32::MAX - 2;
+        mem[1] = u32::MAX - 2;
+        mem[2] = 8;
+        let mut ring = unsafe { Ring::from_raw(mem.as_mut_ptr() as *mut u8) };
+        let mut out = [0u8; 6];
+
+        assert_eq!(ring.push(&[1, 2, 3, 4, 5, 6]), 6);
+        assert_eq!(ring.fill(), 6);
+        assert_eq!(ring.pop(&mut out), 6);
+        assert_eq!(out, [1, 2, 3, 4, 5, 6]);
+    }
+}
@@ -458,6 +458,42 @@ pub fn send_ipc(target: TaskHandle, length: u8) -> Status {
     syscall!(Syscall::SendIPC, target, length as u32).into()
 }
 
+/// Send events to another job, transferring a shared memory to it
+///
+/// # description
+///
+/// This syscall behaves as [`send_ipc`], while atomically transferring the
+/// user credentials of the given shared memory to the target job. This allows
+/// zero-copy buffer passing between jobs with a single syscall, the shared
+/// memory handle being typically part of the IPC message.
+///
+/// The current job must be the shared memory owner or user, and the shared
+/// memory owner must have granted the [`SHMPermission::Transfer`] permission
+/// to the shared memory user. The shared memory is unmapped from the current
+/// job, the target job becomes the shared memory user and is mapped, if
+/// granted the [`SHMPermission::Map`] permission. When the owner emits the
+/// shared memory, the previous user must have unmapped it.
+///
+/// On top of [`send_ipc`] return values, this syscall synchronously returns:
+///
+///    * `Status::Invalid` if the shared memory is not owned or used by the current job
+///    * `Status::Denied` if the shared memory user credentials are not transferable
+///    * `Status::Busy` if the shared memory is still mapped by its previous user,
+///      or if the target job has no free memory resource slot to map it
+///
+/// In these cases, neither the shared memory nor the IPC are emitted.
+///
+/// # examples
+///
+/// ```ignore
+/// uapi::send_ipc_shm(NextStageh, IpcLen, Buffer)?continue_here;
+/// ```
+///
+#[inline(always)]
+pub fn send_ipc_shm(target: TaskHandle, length: u8, shm: ShmHandle) -> Status {
+    syscall!(Syscall::SendIPCShm, target, length as u32, shm).into()
+}
+
 /// Send signal to another job identified by its handle
 ///
 /// # description
@@ -698,6 +734,10 @@ pub fn alarm(timeout_ms: u32, flag: AlarmFlag) -> Status {
 
 /// Send a message from the current task's 'svc_exchange area' through
 /// the UART.
+///
+/// With kernel deferred user logs, the message is queued and emitted later.
+/// [`Status::Busy`] is returned if the message is dropped, either because
+/// the task exceeded its log rate or because the kernel log ring is full.
 #[inline(always)]
 pub fn log(length: usize) -> Status {
     if length > exchange::length() {
@@ -844,6 +884,283 @@ pub fn dma_resume_stream(dmah: StreamHandle) -> Status {
     syscall!(Syscall::DmaResumeStream, dmah).into()
 }
 
+/// Get back a kernel statistic
+///
+/// # Usage
+///
+/// In debug and autotest builds, the kernel records some performance related
+/// statistics, such as the duration of the kernel masked windows, or the
+/// per-syscall, systick and user interrupts handling durations. Each
+/// statistic is identified by a [`KernelStat`] value, and an index for
+/// statistics that are arrays (ignored otherwise, must be 0).
+///
+/// The statistic is returned as a [`kstat::KernelStatInfo`] structure in the
+/// SVC_EXCHANGE area, where it needs to be read afterward.
+///
+/// Requires the CAP_SYS_DEBUG capability. In release builds, no statistic is
+/// recorded and this syscall always returns [`Status::NoEntity`].
+///
+#[inline(always)]
+pub fn get_kernel_stat(stat: KernelStat, index: u32) -> Status {
+    syscall!(Syscall::GetKernelStat, stat as u32, index).into()
+}
+
+/// Trigger the kernel interrupt latency probe
+///
+/// # Usage
+///
+/// In debug builds with the EXTI latency probe enabled, the kernel owns an
+/// EXTI line that can be triggered by software. The probe interrupt is
+/// delivered to the calling task, as any user interrupt, through
+/// [`wait_for_event`] with the [`EventType::Irq`] mask. Its source device
+/// handle is 0.
+///
+/// The trigger is made after `ticks` systicks, or at syscall exit if `ticks`
+/// is 0. The kernel entry and owner wake-up latencies are then readable using
+/// [`get_kernel_stat`] with [`KernelStat::IrqProbeEntry`] and
+/// [`KernelStat::IrqProbeWakeup`].
+///
+/// Requires the CAP_SYS_DEBUG capability. Returns [`Status::Busy`] if the
+/// previous probe interrupt has not been received yet, and
+/// [`Status::NoEntity`] if the probe is not supported by the kernel.
+///
+#[inline(always)]
+pub fn trigger_irq_probe(ticks: u32) -> Status {
+    syscall!(Syscall::TriggerIrqProbe, ticks).into()
+}
+
+/// Write back the data cache content of a shared memory range
+///
+/// # Usage
+///
+/// Shared memories declared with the `outpost,cacheable` DTS property are
+/// mapped as cacheable memory. Before starting a DMA stream that reads such a
+/// shared memory, the range written by the task must be written back to memory.
+///
+/// `offset` and `length` define the range, in bytes, relative to the shared
+/// memory base address. The caller must be the shared memory owner or user.
+/// This syscall has no effect on non-cacheable shared memories or on cores
+/// without data cache.
+///
+/// Returns [`Status::Invalid`] if the handle is not associated to the caller
+/// or if the range is out of the shared memory.
+///
+#[inline(always)]
+pub fn shm_cache_clean(shm: ShmHandle, offset: usize, length: usize) -> Status {
+    syscall!(Syscall::ShmCacheClean, shm, offset as u32, length as u32).into()
+}
+
+/// Discard the data cache content of a shared memory range
+///
+/// # Usage
+///
+/// When a DMA stream has written a cacheable shared memory, the corresponding
+/// cache lines must be discarded before the task reads the range. As
+/// maintenance is made by cache line, partial lines at the range boundaries are
+/// written back before being discarded.
+///
+/// The caller must have write permission on the shared memory, as discarded
+/// lines may hold data not yet written back. This syscall has no effect on
+/// non-cacheable shared memories or on cores without data cache.
+///
+/// Returns [`Status::Invalid`] if the handle is not associated to the caller
+/// or if the range is out of the shared memory, and [`Status::Denied`] if the
+/// caller can't write the shared memory.
+///
+#[inline(always)]
+pub fn shm_cache_invalidate(shm: ShmHandle, offset: usize, length: usize) -> Status {
+    syscall!(
+        Syscall::ShmCacheInvalidate,
+        shm,
+        offset as u32,
+        length as u32
+    )
+    .into()
+}
+
+/// Ring the doorbell of a shared memory ring
+///
+/// # Usage
+///
+/// Shared memories declared with the `outpost,ring` DTS property hold a
+/// [`shm::ShmRing`] header, followed by the ring data area, see [`crate::ring`].
+/// The shared memory owner is the producer, the shared memory user is the
+/// consumer.
+///
+/// Once data has been pushed, the producer rings the doorbell with
+/// [`ShmRingEvent::Produced`]. The consumer is sent a [`Signal::Poll`] signal
+/// only if the ring was empty, or if the ring fill level reached the DTS
+/// defined watermark. Once data has been popped, the consumer rings the
+/// doorbell with [`ShmRingEvent::Consumed`]. The producer is signaled only if
+/// the ring was full.
+///
+/// As a consequence, tasks can push or pop data in bursts and ring the
+/// doorbell without paying for useless peer wake-ups.
+///
+/// Returns [`Status::Invalid`] if the shared memory is not a ring or if the
+/// ring header indexes are corrupted, and [`Status::Denied`] if the caller is
+/// not the producer (resp. consumer) of the ring.
+///
+#[inline(always)]
+pub fn shm_ring_doorbell(shm: ShmHandle, event: ShmRingEvent) -> Status {
+    syscall!(Syscall::ShmRingDoorbell, shm, u32::from(event)).into()
+}
+
+/// Allocate a DMA buffer in a DMA pool shared memory
+///
+/// # Usage
+///
+/// Shared memories declared with the `dma-pool` DTS property are split in
+/// fixed-size blocks (`outpost,dma-block-size`, 32 bytes by default). This
+/// syscall allocates a contiguous run of blocks of at least `length` bytes,
+/// owned by the caller, and sets the buffer offset (u32), relative to the
+/// shared memory base address, in the SVC_EXCHANGE area. As blocks are aligned
+/// on their size, buffers are aligned for any GPDMA transfer.
+///
+/// The caller must be the shared memory owner or user.
+///
+/// Returns [`Status::NoEntity`] if the shared memory is not a DMA pool,
+/// [`Status::Denied`] if the caller is neither the shared memory owner nor
+/// user, and [`Status::Busy`] if no free run of blocks is large enough.
+///
+/// # Example
+///
+/// ```ignore
+/// match sentry_uapi::syscall::shm_dma_alloc(pool, 256) {
+///     Status::Ok => (),
+///     any_err => return (any_err),
+/// }
+/// let exch_area = unsafe { &mut SVC_EXCHANGE_AREA[..4] };
+/// let offset = u32::from_ne_bytes(exch_area.try_into().map_err(|_| Status::Invalid)?);
+/// ```
+///
+#[inline(always)]
+pub fn shm_dma_alloc(shm: ShmHandle, length: usize) -> Status {
+    syscall!(Syscall::ShmDmaAlloc, shm, length as u32).into()
+}
+
+/// Release a DMA buffer previously allocated with [`shm_dma_alloc`]
+///
+/// # Usage
+///
+/// The buffer is identified by its offset in the DMA pool shared memory. Only
+/// the task that has allocated the buffer can release it.
+///
+/// Returns [`Status::Invalid`] if `offset` is not an allocated buffer and
+/// [`Status::Denied`] if the buffer is owned by another task.
+///
+#[inline(always)]
+pub fn shm_dma_free(shm: ShmHandle, offset: usize) -> Status {
+    syscall!(Syscall::ShmDmaFree, shm, offset as u32).into()
+}
+
+/// Copy data from a shared memory to another one
+///
+/// # Usage
+///
+/// The copy descriptor ([`crate::systypes::shm::ShmCopy`]) must have been
+/// set in the SVC_EXCHANGE area using [`crate::copy_to_kernel`] before
+/// calling this syscall. The caller must be the owner or a user of the source
+/// shared memory and must have the write permission on the destination shared
+/// memory. Offsets and length must be word-aligned and the two ranges must not
+/// overlap.
+///
+/// The copy is executed by the kernel-reserved DMA channel, so that large
+/// buffers are moved using bursts instead of a task-level copy loop.
+/// Cache maintenance of both ranges is made by the kernel.
+///
+/// Returns [`Status::NoEntity`] if the kernel DMA copy service is not enabled,
+/// [`Status::Denied`] if the destination is not writeable by the caller, and
+/// [`Status::Invalid`] for any invalid handle, range or alignment.
+///
+/// # Example
+///
+/// ```ignore
+/// let desc = ShmCopy { src: rx_shm, src_offset: 0, dst: tx_shm, dst_offset: 0, len: 1024 };
+/// copy_to_kernel(&desc)?;
+/// match sentry_uapi::syscall::shm_copy() {
+///     Status::Ok => (),
+///     any_err => return (any_err),
+/// }
+/// ```
+///
+#[inline(always)]
+pub fn shm_copy() -> Status {
+    syscall!(Syscall::ShmCopy).into()
+}
+
+/// Get a buffer of random values from the Sentry kernel RNG backend
+///
+/// # Usage
+///
+/// Bulk variant of [`get_random`]: the first `length` bytes of the
+/// SVC_EXCHANGE area are filled with random values in a single syscall.
+/// `length` must not be null and must not exceed the SVC_EXCHANGE area size,
+/// otherwise Status::Invalid is returned.
+///
+/// When the kernel DRBG is enabled, values are delivered by the ChaCha20
+/// DRBG seeded by the kernel entropy source, making this syscall suitable
+/// for high rate nonce generation.
+///
+/// This syscall requires the caller to hold the CAP_CRY_KRNG capability.
+/// Without this capability, Status::Denied is returned.
+///
+/// The syscall may fail if the kernel RNG source fails to properly delivers
+/// a FIPS compliant random value. In that case, the syscall returns
+/// Status::Critical.
+///
+/// # Example
+///
+/// ```ignore
+/// let mut nonces: [u8; 64] = [0; 64];
+/// match get_random_buffer(nonces.len()) {
+///     Status::Ok => (),
+///     any_err => return(any_err),
+/// };
+/// copy_from_kernel(&mut nonces.as_mut_slice())?;
+/// ```
+///
+#[inline(always)]
+pub fn get_random_buffer(length: usize) -> Status {
+    if length == 0 || length > exchange::length() {
+        Status::Invalid
+    } else {
+        syscall!(Syscall::GetRandomBuffer, length as u32).into()
+    }
+}
+
+/// Get the kernel information page address
+///
+/// # Usage
+///
+/// When the kernel is built with CONFIG_MM_KINFO_PAGE, a kernel written page
+/// is mapped read-only in all tasks. It holds the system tick based time and
+/// the task handles directory, which can then be read without any syscall.
+///
+/// This syscall sets the page address, encoded as `u32`, in the SVC_EXCHANGE
+/// area. The address never changes, and is cached by the [`crate::kinfo`]
+/// helpers, which should be used instead of this syscall.
+///
+/// If the kernel is built without the information page, Status::NoEntity is
+/// returned.
+///
+/// # Example
+///
+/// ```ignore
+/// match get_kinfo_page() {
+///     Status::Ok => (),
+///     any_err => return(any_err),
+/// };
+/// let mut addr: [u8; 4] = [0; 4];
+/// copy_from_kernel(&mut addr.as_mut_slice())?;
+/// let page = u32::from_ne_bytes(addr) as *const KinfoPage;
+/// ```
+///
+#[inline(always)]
+pub fn get_kinfo_page() -> Status {
+    syscall!(Syscall::GetKinfoPage).into()
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -93,6 +93,17 @@ pub enum Syscall {
     DmaUnassignStream,
     DmaGetStreamInfo,
     DmaResumeStream,
+    GetKernelStat,
+    TriggerIrqProbe,
+    ShmCacheClean,
+    ShmCacheInvalidate,
+    ShmRingDoorbell,
+    SendIPCShm,
+    ShmDmaAlloc,
+    ShmDmaFree,
+    ShmCopy,
+    GetRandomBuffer,
+    GetKinfoPage,
 }
 }
 
@@ -365,6 +376,24 @@ impl From<AlarmFlag> for u32 {
     }
 }
 
+/// SHM ring doorbell event, see [`crate::syscall::shm_ring_doorbell`]
+#[repr(C)]
+pub enum ShmRingEvent {
+    /// Data has been pushed by the producer (SHM owner)
+    Produced,
+    /// Data has been popped by the consumer (SHM user)
+    Consumed,
+}
+
+impl From<ShmRingEvent> for u32 {
+    fn from(event: ShmRingEvent) -> u32 {
+        match event {
+            ShmRingEvent::Produced => 0,
+            ShmRingEvent::Consumed => 1,
+        }
+    }
+}
+
 /// Permission model definition for shared memories
 #[repr(C)]
 pub enum SHMPermission {
@@ -379,6 +408,9 @@ pub enum SHMPermission {
 
     /// allows target process to transfer SHM to another, pre-allowed, process
     Transfer,
+
+    /// declare target process as an additional read-only reader of the SHM
+    Reader,
 }
 
 /// Converter for SHM permission to register encoding (u32)
@@ -389,6 +421,7 @@ impl From<SHMPermission> for u32 {
             SHMPermission::Read => 0x2,
             SHMPermission::Write => 0x4,
             SHMPermission::Transfer => 0x8,
+            SHMPermission::Reader => 0x10,
         }
     }
 }
@@ -615,6 +648,19 @@ mirror_enum! {
     }
 }
 
+mirror_enum! {
+    u32,
+    pub enum KernelStat {
+        MaskedWindow,
+        Syscall,
+        Systick,
+        UserIrq,
+        IrqProbeEntry,
+        IrqProbeWakeup,
+        MpuLoad,
+    }
+}
+
 /// Header received from the kernel when waiting for at one event type
 ///
 /// Received when returning from [`crate::syscall::wait_for_event`] syscall with
@@ -1054,6 +1100,285 @@ pub mod shm {
             )
         );
     }
+
+    /// SHM to SHM copy descriptor, set in the exchange area before
+    /// [`crate::syscall::shm_copy`]
+    ///
+    /// Offsets are relative to the corresponding shared memory base address.
+    #[repr(C)]
+    #[derive(PartialEq, Debug, Copy, Clone)]
+    pub struct ShmCopy {
+        pub src: crate::systypes::ShmHandle,
+        pub src_offset: u32,
+        pub dst: crate::systypes::ShmHandle,
+        pub dst_offset: u32,
+        pub len: u32,
+    }
+
+    #[test]
+    fn test_layout_shm_copy() {
+        const UNINIT: ::std::mem::MaybeUninit<ShmCopy> = ::std::mem::MaybeUninit::uninit();
+        let ptr = UNINIT.as_ptr();
+        assert_eq!(
+            ::std::mem::size_of::<ShmCopy>(),
+            20usize,
+            concat!("Size of: ", stringify!(ShmCopy))
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).src_offset) as usize - ptr as usize },
+            4usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_copy),
+                "::",
+                stringify!(src_offset)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).dst) as usize - ptr as usize },
+            8usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_copy),
+                "::",
+                stringify!(dst)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).dst_offset) as usize - ptr as usize },
+            12usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_copy),
+                "::",
+                stringify!(dst_offset)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).len) as usize - ptr as usize },
+            16usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_copy),
+                "::",
+                stringify!(len)
+            )
+        );
+    }
+
+    /// SHM ring header, located at the base address of shared memories declared
+    /// with the `outpost,ring` DTS property. See [`crate::ring`].
+    ///
+    /// `capacity` and `watermark` are set by the kernel at boot time.
+    #[repr(C)]
+    #[derive(PartialEq, Debug, Copy, Clone)]
+    pub struct ShmRing {
+        pub head: u32,
+        pub tail: u32,
+        pub capacity: u32,
+        pub watermark: u32,
+    }
+
+    #[test]
+    fn test_layout_shm_ring() {
+        const UNINIT: ::std::mem::MaybeUninit<ShmRing> = ::std::mem::MaybeUninit::uninit();
+        let ptr = UNINIT.as_ptr();
+        assert_eq!(
+            ::std::mem::size_of::<ShmRing>(),
+            16usize,
+            concat!("Size of: ", stringify!(ShmRing))
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).head) as usize - ptr as usize },
+            0usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_ring),
+                "::",
+                stringify!(head)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).tail) as usize - ptr as usize },
+            4usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_ring),
+                "::",
+                stringify!(tail)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).capacity) as usize - ptr as usize },
+            8usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_ring),
+                "::",
+                stringify!(capacity)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).watermark) as usize - ptr as usize },
+            12usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(shm_ring),
+                "::",
+                stringify!(watermark)
+            )
+        );
+    }
+}
+
+/// Kernel statistics related types definitions
+pub mod kstat {
+
+    /// Kernel statistic, as returned by [`crate::syscall::get_kernel_stat`]
+    ///
+    /// All values are in cycles.
+    #[repr(C)]
+    #[derive(PartialEq, Debug, Copy, Clone)]
+    pub struct KernelStatInfo {
+        pub total: u64,
+        pub count: u32,
+        pub min: u32,
+        pub max: u32,
+        pub last: u32,
+    }
+
+    #[test]
+    fn test_layout_kernel_stat_infos() {
+        const UNINIT: ::std::mem::MaybeUninit<KernelStatInfo> = ::std::mem::MaybeUninit::uninit();
+        let ptr = UNINIT.as_ptr();
+        assert_eq!(
+            ::std::mem::size_of::<KernelStatInfo>(),
+            24usize,
+            concat!("Size of: ", stringify!(KernelStatInfo))
+        );
+        assert_eq!(
+            ::std::mem::align_of::<KernelStatInfo>(),
+            8usize,
+            concat!("Alignment of ", stringify!(KernelStatInfo))
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).count) as usize - ptr as usize },
+            8usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kernel_stat_infos),
+                "::",
+                stringify!(count)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).last) as usize - ptr as usize },
+            20usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kernel_stat_infos),
+                "::",
+                stringify!(last)
+            )
+        );
+    }
+}
+
+/// Kernel information page related types definitions
+pub mod kinfo {
+    use crate::systypes::{TaskHandle, TaskLabel};
+
+    /// Kernel information page MPU region size, in bytes
+    pub const KINFO_PAGE_SIZE: usize = 256;
+
+    /// Kernel information page magic value ("KINF")
+    pub const KINFO_MAGIC: u32 = 0x4b49_4e46;
+
+    /// Maximum number of task directory entries
+    pub const KINFO_MAX_TASKS: usize = 16;
+
+    /// Kernel information page task directory entry
+    #[repr(C)]
+    #[derive(PartialEq, Debug, Copy, Clone)]
+    pub struct KinfoTask {
+        pub label: TaskLabel,
+        pub handle: TaskHandle,
+    }
+
+    /// Kernel information page, mapped read-only in all tasks when the kernel
+    /// is built with CONFIG_MM_KINFO_PAGE. See [`crate::kinfo`].
+    ///
+    /// `seq` is odd while the kernel updates the time fields. The task
+    /// directory is set at boot time, before any task is spawned.
+    #[repr(C)]
+    #[derive(PartialEq, Debug, Copy, Clone)]
+    pub struct KinfoPage {
+        pub seq: u32,
+        pub magic: u32,
+        pub cycles_per_usec: u32,
+        pub systick_hz: u32,
+        pub cycles: u64,
+        pub jiffies: u64,
+        pub num_tasks: u32,
+        pub reserved: u32,
+        pub tasks: [KinfoTask; KINFO_MAX_TASKS],
+    }
+
+    #[test]
+    fn test_layout_kinfo_page() {
+        const UNINIT: ::std::mem::MaybeUninit<KinfoPage> = ::std::mem::MaybeUninit::uninit();
+        let ptr = UNINIT.as_ptr();
+        assert_eq!(
+            ::std::mem::size_of::<KinfoPage>(),
+            168usize,
+            concat!("Size of: ", stringify!(KinfoPage))
+        );
+        assert_eq!(
+            ::std::mem::align_of::<KinfoPage>(),
+            8usize,
+            concat!("Alignment of ", stringify!(KinfoPage))
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).cycles) as usize - ptr as usize },
+            16usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kinfo_page),
+                "::",
+                stringify!(cycles)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).jiffies) as usize - ptr as usize },
+            24usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kinfo_page),
+                "::",
+                stringify!(jiffies)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).num_tasks) as usize - ptr as usize },
+            32usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kinfo_page),
+                "::",
+                stringify!(num_tasks)
+            )
+        );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).tasks) as usize - ptr as usize },
+            40usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(kinfo_page),
+                "::",
+                stringify!(tasks)
+            )
+        );
+    }
 }
 
 /// DMA related types definitions
@@ -1196,6 +1521,7 @@ pub mod dma {
         pub transfer_mode: u8,
         pub src_beat_len: u8,
         pub dest_beat_len: u8,
+        pub linked_list: u8,
     }
 
     // test that the Rust structure fields offset do match the corresponding C one,
@@ -1375,6 +1701,16 @@ pub mod dma {
                 stringify!(dest_beat_len)
             )
         );
+        assert_eq!(
+            unsafe { ::std::ptr::addr_of!((*ptr).linked_list) as usize - ptr as usize },
+            41usize,
+            concat!(
+                "Offset of field: ",
+                stringify!(gpdma_stream_cfg),
+                "::",
+                stringify!(linked_list)
+            )
+        );
     }
 
     pub enum GpdmaChanState {